@@ -9,6 +9,13 @@
  History
  When           Who     What/Why
  -------------- ---     --------
+ 11/19/20 15:00 kcao    FRAME_TIMER paces the display frames
+ 11/17/20 18:30 kcao    FX_TIMER drives the display effects
+ 11/16/20 10:15 kcao    Check4WriteDone dropped, the OLED DMA interrupt
+                        posts ES_UPDATE_COMPLETE
+ 11/15/20 14:20 kcao    added trace buffer switch
+ 11/14/20 10:05 kcao    added event recorder switch and per-service state
+                        query hooks
  12/19/16 20:19  jec     removed EVENT_CHECK_HEADER definition. This goes with
                          the V2.3 move to a single wrapper for event checking
                          headers
@@ -35,6 +42,22 @@
 // a particular application. It will vary in value from 1 to MAX_NUM_SERVICES
 #define NUM_SERVICES 5
 
+/****************************************************************************/
+// Uncomment to build the event recorder (ES_EventRecorder.c) into the
+// framework. Every post and dispatch is then captured into a RAM ring of
+// EVENT_RECORDER_SIZE records (8 bytes each, must be a power of 2) that can be
+// dumped over the terminal and replayed on the host with Tools/EventReplay
+//#define _INCLUDE_EVENT_RECORDER_
+#define EVENT_RECORDER_SIZE 512
+
+/****************************************************************************/
+// Uncomment to build the binary trace buffer (ES_Trace.c). ES_TRACE() points
+// then cost a few dozen cycles and are drained to the terminal UART by DMA
+// channel 0. TRACE_SIZE is the ring size in 12 byte records, a power of 2.
+// Decode the terminal capture with Tools/TraceDecode
+//#define _INCLUDE_TRACE_
+#define TRACE_SIZE 64
+
 /****************************************************************************/
 // These are the definitions for Service 0, the lowest priority service.
 // Every Events and Services application must have a Service 0. Further
@@ -64,6 +87,8 @@
 #define SERV_1_RUN RunDisplay
 // How big should this services Queue be?
 #define SERV_1_QUEUE_SIZE 5
+// state query recorded after each dispatch by the event recorder
+#define SERV_1_STATE_QUERY QueryDisplay
 #endif
 
 /****************************************************************************/
@@ -77,6 +102,8 @@
 #define SERV_2_RUN RunSequence
 // How big should this services Queue be?
 #define SERV_2_QUEUE_SIZE 15
+// state query recorded after each dispatch by the event recorder
+#define SERV_2_STATE_QUERY QuerySequence
 #endif
 
 /****************************************************************************/
@@ -90,6 +117,8 @@
 #define SERV_3_RUN RunDotstar
 // How big should this services Queue be?
 #define SERV_3_QUEUE_SIZE 3
+// state query recorded after each dispatch by the event recorder
+#define SERV_3_STATE_QUERY QueryDotstar
 #endif
 
 /****************************************************************************/
@@ -103,6 +132,8 @@
 #define SERV_4_RUN RunGameState
 // How big should this services Queue be?
 #define SERV_4_QUEUE_SIZE 3
+// state query recorded after each dispatch by the event recorder
+#define SERV_4_STATE_QUERY QueryGameState
 #endif
 
 /****************************************************************************/
@@ -319,7 +350,7 @@ typedef enum
 
 /****************************************************************************/
 // This is the list of event checking functions
-#define EVENT_CHECK_LIST CheckTouchSensor, Check4Keystroke, Check4WriteDone
+#define EVENT_CHECK_LIST CheckTouchSensor, Check4Keystroke
 
 /****************************************************************************/
 // These are the definitions for the post functions to be executed when the
@@ -336,8 +367,8 @@ typedef enum
 #define TIMER5_RESP_FUNC PostSequence       // InputTimer
 #define TIMER6_RESP_FUNC TIMER_UNUSED       // IdleTimer
 #define TIMER7_RESP_FUNC PostGameState      // LastDirectionTimer
-#define TIMER8_RESP_FUNC TIMER_UNUSED
-#define TIMER9_RESP_FUNC TIMER_UNUSED
+#define TIMER8_RESP_FUNC PostDisplay        // FxTimer
+#define TIMER9_RESP_FUNC PostDisplay        // FrameTimer
 #define TIMER10_RESP_FUNC TIMER_UNUSED
 #define TIMER11_RESP_FUNC PostTestHarnessService0
 #define TIMER12_RESP_FUNC TIMER_UNUSED
@@ -359,6 +390,8 @@ typedef enum
 #define INPUT_TIMER 5
 #define IDLE_TIMER 6
 #define LAST_DIRECTION_TIMER 7
+#define FX_TIMER 8
+#define FRAME_TIMER 9
 
 #define TEST_TIMER 11
 
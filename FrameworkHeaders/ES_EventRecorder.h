@@ -0,0 +1,73 @@
+/****************************************************************************
+ Module
+     ES_EventRecorder.h
+ Description
+     header file for the optional event recorder. When the framework is built
+     with _INCLUDE_EVENT_RECORDER_ defined, every post and every dispatch is
+     captured into a RAM ring that can be dumped over the terminal UART and
+     replayed on the host by Tools/EventReplay.
+ Notes
+     Record layout (8 bytes, little endian, as sent by ES_Recorder_Dump):
+       uint16_t Tick        ES_Timer_GetTime() when the record was made
+       uint16_t EventParam
+       uint8_t  EventType
+       uint8_t  Service     target of a post / service that ran a dispatch
+                            ES_REC_ALL_SERVICES for ES_PostAll
+       uint8_t  Source      posts: index of the posting service or one of
+                            ES_REC_SOURCE_xxx
+                            dispatches: state of the service after the run
+                            function returned, ES_REC_NO_STATE if unknown
+       uint8_t  Flags       ES_REC_xxx kind and status bits
+
+     Dump format:
+       'E' 'S' 'R' ES_REC_VERSION
+       uint16_t record size, uint16_t ring capacity
+       uint32_t total number of records made since ES_Initialize
+       min(total, capacity) records, oldest first
+       uint16_t sum of all record bytes
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/14/20 10:05 kcao    started coding
+*****************************************************************************/
+
+#ifndef ES_EventRecorder_H
+#define ES_EventRecorder_H
+
+#include "ES_Types.h"
+#include "ES_Events.h"
+
+#define ES_REC_VERSION 1
+
+// values for the Flags field
+#define ES_REC_POST_FIFO  0x01
+#define ES_REC_POST_LIFO  0x02
+#define ES_REC_DISPATCH   0x04
+#define ES_REC_FAILED     0x80  /* queue was full, post was dropped */
+
+// special values for the Service and Source fields
+#define ES_REC_ALL_SERVICES   0xFF
+#define ES_REC_SOURCE_INTS    0xFE  /* posted from _HW_Process_Pending_Ints */
+#define ES_REC_SOURCE_CHECKER 0xFD  /* posted from an event checker */
+#define ES_REC_NO_STATE       0xFF
+
+typedef struct
+{
+  uint16_t Tick;
+  uint16_t EventParam;
+  uint8_t EventType;
+  uint8_t Service;
+  uint8_t Source;
+  uint8_t Flags;
+}ES_EventRecord_t;
+
+void ES_Recorder_Init(void);
+void ES_Recorder_SetSource(uint8_t Source);
+void ES_Recorder_Post(uint8_t WhichService, ES_Event_t ThisEvent,
+    uint8_t Flags);
+void ES_Recorder_Dispatch(uint8_t WhichService, ES_Event_t ThisEvent);
+uint32_t ES_Recorder_GetTotal(void);
+bool ES_Recorder_GetRecord(uint16_t Index, ES_EventRecord_t *pRecord);
+void ES_Recorder_Dump(void);
+
+#endif   // ES_EventRecorder_H
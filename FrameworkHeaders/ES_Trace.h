@@ -0,0 +1,56 @@
+/****************************************************************************
+ Module
+     ES_Trace.h
+ Description
+     header file for the binary trace buffer. Trace points are fixed size
+     records that go into a RAM ring and are drained to the terminal UART by
+     DMA, so a trace point costs a few dozen cycles instead of the
+     millisecond a printf line takes at 115200 baud.
+ Notes
+     Compiled in only when _INCLUDE_TRACE_ is defined (see ES_Configure.h).
+     Without it ES_TRACE() expands to nothing.
+
+     Record layout on the wire (12 bytes, little endian):
+       uint8_t  Sync       ES_TRACE_SYNC
+       uint8_t  Id         application defined, see TraceIds.h
+       uint16_t Arg1
+       uint16_t Arg2
+       uint16_t Check      Id ^ Arg1 ^ Arg2 ^ both halves of Timestamp
+       uint32_t Timestamp  core timer count (20MHz)
+     Text from printf may sit between records, Tools/TraceDecode sorts the
+     two apart.
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/15/20 14:20 kcao    started coding
+*****************************************************************************/
+
+#ifndef ES_Trace_H
+#define ES_Trace_H
+
+#include "ES_Types.h"
+
+#define ES_TRACE_SYNC 0xA5
+
+typedef struct
+{
+  uint8_t Sync;
+  uint8_t Id;
+  uint16_t Arg1;
+  uint16_t Arg2;
+  uint16_t Check;
+  uint32_t Timestamp;
+}ES_TraceRecord_t;
+
+#ifdef _INCLUDE_TRACE_
+#define ES_TRACE(Id, Arg1, Arg2) ES_Trace_Record((Id), (Arg1), (Arg2))
+#else
+#define ES_TRACE(Id, Arg1, Arg2) ((void)0)
+#endif
+
+void ES_Trace_Init(void);
+void ES_Trace_Record(uint8_t Id, uint16_t Arg1, uint16_t Arg2);
+bool ES_Trace_WaitDrained(void);
+uint16_t ES_Trace_GetDropped(void);
+
+#endif   // ES_Trace_H
@@ -0,0 +1,320 @@
+/****************************************************************************
+ Module
+     ES_EventRecorder.c
+
+ Description
+     Optional recorder for the Events & Services framework. Captures every
+     post (with its target service, the posting context and the tick) and
+     every dispatch (with the state of the service afterwards) into a RAM
+     ring. The ring can be dumped over the terminal UART and fed to
+     Tools/EventReplay to re-run GameState/Seq under virtual time.
+ Notes
+     Only compiled in when _INCLUDE_EVENT_RECORDER_ is defined. The size of
+     the ring is set by EVENT_RECORDER_SIZE in ES_Configure.h and must be a
+     power of 2. A trace can only be replayed if the ring did not wrap, so
+     size it to cover the session you want to capture.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/14/20 10:05 kcao    started coding
+****************************************************************************/
+
+/*----------------------------- Include Files -----------------------------*/
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "ES_Port.h"
+#include "ES_EventRecorder.h"
+// the state query functions named in ES_Configure.h
+#include "ES_ServiceHeaders.h"
+
+#ifdef _INCLUDE_EVENT_RECORDER_
+
+#if (EVENT_RECORDER_SIZE & (EVENT_RECORDER_SIZE - 1)) != 0
+#error "EVENT_RECORDER_SIZE must be a power of 2"
+#endif
+
+/*----------------------------- Module Defines ----------------------------*/
+#define RECORD_MASK (EVENT_RECORDER_SIZE - 1)
+
+/*---------------------------- Module Functions ---------------------------*/
+static void AddRecord(ES_EventRecord_t *pRecord);
+static uint8_t QueryServiceState(uint8_t WhichService);
+static void WriteByteSummed(uint8_t Byte, uint16_t *pSum);
+
+/*---------------------------- Module Variables ---------------------------*/
+static ES_EventRecord_t Records[EVENT_RECORDER_SIZE];
+// total number of records made, the ring holds the last EVENT_RECORDER_SIZE
+static uint32_t Total;
+// who is posting right now, set by ES_Initialize and ES_Run
+static uint8_t CurrentSource;
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+   ES_Recorder_Init
+ Parameters
+   None
+ Returns
+   None
+ Description
+   empties the ring. Called from ES_Initialize before the service inits so
+   that the ES_INIT posts are part of the trace
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+void ES_Recorder_Init(void)
+{
+  Total = 0;
+  CurrentSource = ES_REC_SOURCE_INTS;
+}
+
+/****************************************************************************
+ Function
+   ES_Recorder_SetSource
+ Parameters
+   uint8_t : service index that is about to run, or ES_REC_SOURCE_xxx
+ Returns
+   None
+ Description
+   tags the following posts with the context they are made from
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+void ES_Recorder_SetSource(uint8_t Source)
+{
+  CurrentSource = Source;
+}
+
+/****************************************************************************
+ Function
+   ES_Recorder_Post
+ Parameters
+   uint8_t : target service, ES_REC_ALL_SERVICES for ES_PostAll
+   ES_Event_t : the event that was posted
+   uint8_t : ES_REC_POST_FIFO or ES_REC_POST_LIFO, plus ES_REC_FAILED
+ Returns
+   None
+ Description
+   records one post
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+void ES_Recorder_Post(uint8_t WhichService, ES_Event_t ThisEvent,
+    uint8_t Flags)
+{
+  ES_EventRecord_t NewRecord;
+
+  NewRecord.Tick = ES_Timer_GetTime();
+  NewRecord.EventParam = ThisEvent.EventParam;
+  NewRecord.EventType = (uint8_t)ThisEvent.EventType;
+  NewRecord.Service = WhichService;
+  NewRecord.Source = CurrentSource;
+  NewRecord.Flags = Flags;
+  AddRecord(&NewRecord);
+}
+
+/****************************************************************************
+ Function
+   ES_Recorder_Dispatch
+ Parameters
+   uint8_t : the service whose run function was just called
+   ES_Event_t : the event it was handed
+ Returns
+   None
+ Description
+   records one dispatch along with the state the service ended up in
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+void ES_Recorder_Dispatch(uint8_t WhichService, ES_Event_t ThisEvent)
+{
+  ES_EventRecord_t NewRecord;
+
+  NewRecord.Tick = ES_Timer_GetTime();
+  NewRecord.EventParam = ThisEvent.EventParam;
+  NewRecord.EventType = (uint8_t)ThisEvent.EventType;
+  NewRecord.Service = WhichService;
+  NewRecord.Source = QueryServiceState(WhichService);
+  NewRecord.Flags = ES_REC_DISPATCH;
+  AddRecord(&NewRecord);
+}
+
+/****************************************************************************
+ Function
+   ES_Recorder_GetTotal
+ Parameters
+   None
+ Returns
+   uint32_t : number of records made since ES_Recorder_Init
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+uint32_t ES_Recorder_GetTotal(void)
+{
+  return Total;
+}
+
+/****************************************************************************
+ Function
+   ES_Recorder_GetRecord
+ Parameters
+   uint16_t : index of the record, 0 is the oldest one still in the ring
+   ES_EventRecord_t * : where to copy it
+ Returns
+   bool : false if there is no such record
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+bool ES_Recorder_GetRecord(uint16_t Index, ES_EventRecord_t *pRecord)
+{
+  uint32_t First;
+
+  if (Total > EVENT_RECORDER_SIZE)
+  {
+    First = Total - EVENT_RECORDER_SIZE;
+  }
+  else
+  {
+    First = 0;
+  }
+  if ((First + Index) >= Total)
+  {
+    return false;
+  }
+  *pRecord = Records[(First + Index) & RECORD_MASK];
+  return true;
+}
+
+/****************************************************************************
+ Function
+   ES_Recorder_Dump
+ Parameters
+   None
+ Returns
+   None
+ Description
+   writes the ring, oldest record first, to the terminal UART in the format
+   described in ES_EventRecorder.h
+ Notes
+   blocks for about 1ms per 11 bytes at 115200 baud, so only call it when
+   the game is idle (TestHarnessService0 does it on the 'D' key)
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+void ES_Recorder_Dump(void)
+{
+  ES_EventRecord_t ThisRecord;
+  uint32_t TotalAtDump = Total;
+  uint16_t Count;
+  uint16_t i;
+  uint16_t Sum = 0;
+
+  Count = (TotalAtDump > EVENT_RECORDER_SIZE) ?
+      EVENT_RECORDER_SIZE : (uint16_t)TotalAtDump;
+
+  Terminal_WriteByte('E');
+  Terminal_WriteByte('S');
+  Terminal_WriteByte('R');
+  Terminal_WriteByte(ES_REC_VERSION);
+  Terminal_WriteByte(sizeof(ES_EventRecord_t));
+  Terminal_WriteByte(0);
+  Terminal_WriteByte((uint8_t)EVENT_RECORDER_SIZE);
+  Terminal_WriteByte((uint8_t)(EVENT_RECORDER_SIZE >> 8));
+  for (i = 0; i < 4; i++)
+  {
+    Terminal_WriteByte((uint8_t)(TotalAtDump >> (8 * i)));
+  }
+  for (i = 0; i < Count; i++)
+  {
+    ES_Recorder_GetRecord(i, &ThisRecord);
+    WriteByteSummed((uint8_t)ThisRecord.Tick, &Sum);
+    WriteByteSummed((uint8_t)(ThisRecord.Tick >> 8), &Sum);
+    WriteByteSummed((uint8_t)ThisRecord.EventParam, &Sum);
+    WriteByteSummed((uint8_t)(ThisRecord.EventParam >> 8), &Sum);
+    WriteByteSummed(ThisRecord.EventType, &Sum);
+    WriteByteSummed(ThisRecord.Service, &Sum);
+    WriteByteSummed(ThisRecord.Source, &Sum);
+    WriteByteSummed(ThisRecord.Flags, &Sum);
+  }
+  Terminal_WriteByte((uint8_t)Sum);
+  Terminal_WriteByte((uint8_t)(Sum >> 8));
+}
+
+/***************************************************************************
+ private functions
+ ***************************************************************************/
+static void AddRecord(ES_EventRecord_t *pRecord)
+{
+  EnterCritical();  // posts may come from an interrupt
+  Records[Total & RECORD_MASK] = *pRecord;
+  Total++;
+  ExitCritical();
+}
+
+static uint8_t QueryServiceState(uint8_t WhichService)
+{
+  switch (WhichService)
+  {
+#ifdef SERV_0_STATE_QUERY
+    case 0:  return (uint8_t)SERV_0_STATE_QUERY();
+#endif
+#ifdef SERV_1_STATE_QUERY
+    case 1:  return (uint8_t)SERV_1_STATE_QUERY();
+#endif
+#ifdef SERV_2_STATE_QUERY
+    case 2:  return (uint8_t)SERV_2_STATE_QUERY();
+#endif
+#ifdef SERV_3_STATE_QUERY
+    case 3:  return (uint8_t)SERV_3_STATE_QUERY();
+#endif
+#ifdef SERV_4_STATE_QUERY
+    case 4:  return (uint8_t)SERV_4_STATE_QUERY();
+#endif
+#ifdef SERV_5_STATE_QUERY
+    case 5:  return (uint8_t)SERV_5_STATE_QUERY();
+#endif
+#ifdef SERV_6_STATE_QUERY
+    case 6:  return (uint8_t)SERV_6_STATE_QUERY();
+#endif
+#ifdef SERV_7_STATE_QUERY
+    case 7:  return (uint8_t)SERV_7_STATE_QUERY();
+#endif
+#ifdef SERV_8_STATE_QUERY
+    case 8:  return (uint8_t)SERV_8_STATE_QUERY();
+#endif
+#ifdef SERV_9_STATE_QUERY
+    case 9:  return (uint8_t)SERV_9_STATE_QUERY();
+#endif
+#ifdef SERV_10_STATE_QUERY
+    case 10: return (uint8_t)SERV_10_STATE_QUERY();
+#endif
+#ifdef SERV_11_STATE_QUERY
+    case 11: return (uint8_t)SERV_11_STATE_QUERY();
+#endif
+#ifdef SERV_12_STATE_QUERY
+    case 12: return (uint8_t)SERV_12_STATE_QUERY();
+#endif
+#ifdef SERV_13_STATE_QUERY
+    case 13: return (uint8_t)SERV_13_STATE_QUERY();
+#endif
+#ifdef SERV_14_STATE_QUERY
+    case 14: return (uint8_t)SERV_14_STATE_QUERY();
+#endif
+#ifdef SERV_15_STATE_QUERY
+    case 15: return (uint8_t)SERV_15_STATE_QUERY();
+#endif
+    default:
+      return ES_REC_NO_STATE;
+  }
+}
+
+static void WriteByteSummed(uint8_t Byte, uint16_t *pSum)
+{
+  *pSum += Byte;
+  Terminal_WriteByte(Byte);
+}
+
+#endif /* _INCLUDE_EVENT_RECORDER_ */
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
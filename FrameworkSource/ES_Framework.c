@@ -8,6 +8,7 @@
  History
  When           Who     What/Why
  -------------- ---     --------
+ 11/14/20 10:05 kcao    added conditional hooks for the event recorder
  08/21/17 13:18 jec     added conditional call to initialize the port lines
                         for the hardware debugging of the framework/apps
  12/19/16 20:18 jec      changed includes to accomodate the change to a fixed
@@ -34,6 +35,7 @@
 #include "../FrameworkHeaders/ES_Timers.h"
 #include "../FrameworkHeaders/ES_General.h"
 #include "../FrameworkHeaders/ES_CheckEvents.h"
+#include "../FrameworkHeaders/ES_EventRecorder.h"
 // Include the header files for the Service modules.
 // This gets you the prototypes for the public service functions.
 
@@ -257,6 +259,9 @@ ES_Return_t ES_Initialize(TimerRate_t NewRate)
 {
   uint8_t i;
   ES_Timer_Init(NewRate);  // start up the timer subsystem
+#ifdef _INCLUDE_EVENT_RECORDER_
+  ES_Recorder_Init();
+#endif
   // loop through the list testing for NULL pointers and
   for (i = 0; i < ARRAY_SIZE(ServDescList); i++)
   {
@@ -267,12 +272,18 @@ ES_Return_t ES_Initialize(TimerRate_t NewRate)
     }
     // and initializing the event queues (must happen before running inits)
     ES_InitQueue(EventQueues[i].pMem, EventQueues[i].Size);
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_SetSource(i);
+#endif
     // executing the init functions
     if (ServDescList[i].InitFunc(i) != true)
     {
       return FailedInit; // this is a failed initialization
     }
   }
+#ifdef _INCLUDE_EVENT_RECORDER_
+  ES_Recorder_SetSource(ES_REC_SOURCE_INTS);
+#endif
 #ifdef _INCLUDE_BASIC_FRAMEWORK_DEBUG_
   _HW_DebugLines_Init();
 #endif
@@ -316,12 +327,20 @@ ES_Return_t ES_Run(void)
       }
 #ifdef _INCLUDE_BASIC_FRAMEWORK_DEBUG_
       _HW_DebugSetLine1();
+#endif
+#ifdef _INCLUDE_EVENT_RECORDER_
+      ES_Recorder_SetSource(HighestPrior);
 #endif
       if (ServDescList[HighestPrior].RunFunc(ThisEvent).EventType !=
           ES_NO_EVENT)
       {
         return FailedRun;
       }
+#ifdef _INCLUDE_EVENT_RECORDER_
+      ES_Recorder_Dispatch(HighestPrior, ThisEvent);
+      // anything posted before the next run function comes from the ints
+      ES_Recorder_SetSource(ES_REC_SOURCE_INTS);
+#endif
 #ifdef _INCLUDE_BASIC_FRAMEWORK_DEBUG_
       _HW_DebugClearLine1();
 #endif
@@ -331,7 +350,13 @@ ES_Return_t ES_Run(void)
     _HW_DebugSetLine2();
 #endif
     // all the queues are empty, so look for new user detected events
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_SetSource(ES_REC_SOURCE_CHECKER);
+#endif
     ES_CheckUserEvents();
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_SetSource(ES_REC_SOURCE_INTS);
+#endif
 #ifdef _INCLUDE_BASIC_FRAMEWORK_DEBUG_
     _HW_DebugClearLine2();
 #endif
@@ -369,10 +394,17 @@ bool ES_PostAll(ES_Event_t ThisEvent)
   }
   if (i == ARRAY_SIZE(EventQueues))    // if no failures
   {
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_Post(ES_REC_ALL_SERVICES, ThisEvent, ES_REC_POST_FIFO);
+#endif
     return true;
   }
   else
   {
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_Post(ES_REC_ALL_SERVICES, ThisEvent,
+        ES_REC_POST_FIFO | ES_REC_FAILED);
+#endif
     return false;
   }
 }
@@ -399,10 +431,16 @@ bool ES_PostToService(uint8_t WhichService, ES_Event_t TheEvent)
         true))
   {
     Ready |= BitNum2SetMask[WhichService]; // show queue as non-empty
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_Post(WhichService, TheEvent, ES_REC_POST_FIFO);
+#endif
     return true;
   }
   else
   {
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_Post(WhichService, TheEvent, ES_REC_POST_FIFO | ES_REC_FAILED);
+#endif
     return false;
   }
 }
@@ -429,10 +467,16 @@ bool ES_PostToServiceLIFO(uint8_t WhichService, ES_Event_t TheEvent)
         true))
   {
     Ready |= BitNum2SetMask[WhichService]; // show queue as non-empty
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_Post(WhichService, TheEvent, ES_REC_POST_LIFO);
+#endif
     return true;
   }
   else
   {
+#ifdef _INCLUDE_EVENT_RECORDER_
+    ES_Recorder_Post(WhichService, TheEvent, ES_REC_POST_LIFO | ES_REC_FAILED);
+#endif
     return false;
   }
 }
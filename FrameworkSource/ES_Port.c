@@ -13,6 +13,7 @@
  History
  When           Who     What/Why
  -------------- ---     --------
+ 11/15/20 14:20 kcao    start the trace buffer after the terminal
  10/05/20 18:52 ram     started work on port to PIC32MX170F256B
  04/18/19 10:17 jec     started work on port to PIC16F15356
  08/21/17 13:47 jec     added functions to init 2 lines for debugging the framework
@@ -76,6 +77,8 @@
 #include "ES_Timers.h"
 
 #include "terminal.h"
+#include "ES_Configure.h"
+#include "ES_Trace.h"
 
 // TickCount is used to track the number of timer ints that have occurred
 // since the last check. It should really never be more than 1, but just to
@@ -122,6 +125,9 @@ uint8_t _INTCON_temp;
 void _HW_PIC32Init(void)
 {
   Terminal_HWInit();
+#ifdef _INCLUDE_TRACE_
+  ES_Trace_Init();
+#endif
 #if 0
   while(1){
     if(kbhit()){
@@ -0,0 +1,269 @@
+/****************************************************************************
+ Module
+   ES_Trace.c
+
+ Revision
+   1.0.0
+
+ Description
+   Binary trace buffer for the PIC32 port. ES_Trace_Record claims a slot in
+   a RAM ring with a compare and swap, fills it in and marks it complete.
+   DMA channel 0, triggered by the UART1 TX interrupt flag, copies complete
+   records to U1TXREG in the background.
+
+ Notes
+   Producers never block or disable interrupts, so trace points can be used
+   from any interrupt level. If the ring is full the record is dropped and
+   counted (ES_Trace_GetDropped).
+   Only the drain side takes a short critical region, to keep the ISR and a
+   producer from both starting the channel.
+   Terminal_WriteByte waits for a drain to finish before writing, so printf
+   text only ever lands between whole records. Where the block done
+   interrupt can not run (interrupts off, or inside an interrupt at its
+   priority or above) the drain would never finish, so the text byte is
+   written without waiting. It may then split a record; TraceDecode checks
+   the sync byte and check word of each record, so it prints the pieces as
+   text and the records around them are still decoded.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/15/20 14:20 kcao    started coding
+ 11/20/20 11:30 kcao    terminal never waits for a drain that can not end
+ 11/20/20 13:00 kcao    text written anyway when the drain can not end
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <xc.h>
+#include <cp0defs.h> // for _CP0_GET_COUNT
+#include <sys/attribs.h>
+#include <sys/kmem.h>
+
+#include "ES_Configure.h"
+#include "ES_Port.h"
+#include "ES_Trace.h"
+
+#ifdef _INCLUDE_TRACE_
+
+#if (TRACE_SIZE & (TRACE_SIZE - 1)) != 0
+#error "TRACE_SIZE must be a power of 2"
+#endif
+
+/*----------------------------- Module Defines ----------------------------*/
+#define TRACE_MASK (TRACE_SIZE - 1)
+// priority of the block done interrupt, the same as IPL2AUTO on its ISR
+#define TRACE_IPL 2
+
+/*---------------------------- Module Functions ---------------------------*/
+static void StartDrain(void);
+
+/*---------------------------- Module Variables ---------------------------*/
+static ES_TraceRecord_t Ring[TRACE_SIZE];
+// Head is the next slot to claim, Tail the oldest slot not yet sent
+static volatile uint32_t Head;
+static volatile uint32_t Tail;
+// number of records in the block the DMA is currently sending, 0 if idle
+static volatile uint32_t InFlight;
+static volatile uint16_t Dropped;
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+   ES_Trace_Init
+ Parameters
+   None
+ Returns
+   None
+ Description
+   sets up DMA channel 0 to feed UART1. Call after Terminal_HWInit
+ Author
+   K Cao, 11/15/20
+****************************************************************************/
+void ES_Trace_Init(void)
+{
+  Head = 0;
+  Tail = 0;
+  InFlight = 0;
+  Dropped = 0;
+
+  // UART1 TX interrupt flag set whenever there is room in the TX FIFO
+  U1STAbits.UTXISEL = 0;
+
+  DMACONbits.ON = 1;
+  DCH0CON = 0;
+  DCH0CONbits.CHPRI = 0;  // lowest channel priority
+  DCH0ECON = 0;
+  DCH0ECONbits.CHSIRQ = _UART1_TX_IRQ;
+  DCH0ECONbits.SIRQEN = 1;
+  DCH0DSA = KVA_TO_PA(&U1TXREG);
+  DCH0DSIZ = 1;
+  DCH0CSIZ = 1;           // one byte per TX flag
+  DCH0INTCLR = 0xFF;
+  DCH0INTbits.CHBCIE = 1; // interrupt when the block is done
+
+  IPC10bits.DMA0IP = TRACE_IPL;   // below the framework tick
+  IFS1CLR = _IFS1_DMA0IF_MASK;
+  IEC1SET = _IEC1_DMA0IE_MASK;
+}
+
+/****************************************************************************
+ Function
+   ES_Trace_Record
+ Parameters
+   uint8_t : record id
+   uint16_t, uint16_t : arguments
+ Returns
+   None
+ Description
+   adds one record to the ring and starts the DMA if it is idle
+ Notes
+   the ES_TRACE macro compiles calls away when tracing is off
+ Author
+   K Cao, 11/15/20
+****************************************************************************/
+void ES_Trace_Record(uint8_t Id, uint16_t Arg1, uint16_t Arg2)
+{
+  uint32_t Slot;
+  uint32_t Timestamp = _CP0_GET_COUNT();
+  ES_TraceRecord_t *pRecord;
+
+  // claim a slot, lock free so that interrupts may trace too
+  do
+  {
+    Slot = Head;
+    if ((Slot - Tail) >= TRACE_SIZE)
+    {
+      Dropped++;
+      return;
+    }
+  } while (!__sync_bool_compare_and_swap(&Head, Slot, Slot + 1));
+
+  pRecord = &Ring[Slot & TRACE_MASK];
+  pRecord->Id = Id;
+  pRecord->Arg1 = Arg1;
+  pRecord->Arg2 = Arg2;
+  pRecord->Timestamp = Timestamp;
+  pRecord->Check = Id ^ Arg1 ^ Arg2 ^ (uint16_t)Timestamp ^
+      (uint16_t)(Timestamp >> 16);
+  // the sync byte marks the record as complete, so it goes in last
+  __sync_synchronize();
+  pRecord->Sync = ES_TRACE_SYNC;
+
+  if (InFlight == 0)
+  {
+    StartDrain();
+  }
+}
+
+/****************************************************************************
+ Function
+   ES_Trace_WaitDrained
+ Parameters
+   None
+ Returns
+   bool : true once the DMA is not sending records, false if it is and can
+   not be waited for
+ Description
+   used by Terminal_WriteByte to keep text out of the middle of a record
+ Notes
+   only the block done interrupt ends a drain. If it can not run from here,
+   because interrupts are off (EnterCritical) or the caller is an interrupt
+   at TRACE_IPL or above, waiting would never end, so it returns false
+ Author
+   K Cao, 11/15/20
+****************************************************************************/
+bool ES_Trace_WaitDrained(void)
+{
+  uint32_t Status;
+
+  while (InFlight != 0)
+  {
+    Status = _CP0_GET_STATUS();
+    if (!(Status & _CP0_STATUS_IE_MASK) ||
+        (Status & (_CP0_STATUS_EXL_MASK | _CP0_STATUS_ERL_MASK)) ||
+        (((Status & _CP0_STATUS_IPL_MASK) >> _CP0_STATUS_IPL_POSITION) >=
+        TRACE_IPL))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/****************************************************************************
+ Function
+   ES_Trace_GetDropped
+ Parameters
+   None
+ Returns
+   uint16_t : records dropped because the ring was full
+ Author
+   K Cao, 11/15/20
+****************************************************************************/
+uint16_t ES_Trace_GetDropped(void)
+{
+  return Dropped;
+}
+
+/****************************************************************************
+ Function
+   _DMA0_IntHandler
+ Parameters
+   None
+ Returns
+   None
+ Description
+   block done: free the records that were sent and start on the next ones
+ Author
+   K Cao, 11/15/20
+****************************************************************************/
+void __ISR(_DMA_0_VECTOR, IPL2AUTO) _DMA0_IntHandler(void)
+{
+  uint32_t i;
+
+  DCH0INTCLR = 0xFF;
+  IFS1CLR = _IFS1_DMA0IF_MASK;
+  for (i = 0; i < InFlight; i++)
+  {
+    Ring[(Tail + i) & TRACE_MASK].Sync = 0;
+  }
+  Tail += InFlight;
+  InFlight = 0;
+  StartDrain();
+}
+
+/***************************************************************************
+ private functions
+ ***************************************************************************/
+// sends the run of complete records starting at Tail, up to the end of Ring
+static void StartDrain(void)
+{
+  uint32_t IntState;
+  uint32_t Count = 0;
+  uint32_t First;
+
+  IntState = __builtin_get_isr_state();
+  __builtin_disable_interrupts();
+  if (InFlight == 0)
+  {
+    First = Tail & TRACE_MASK;
+    while (((First + Count) < TRACE_SIZE) && ((Tail + Count) != Head) &&
+        (Ring[First + Count].Sync == ES_TRACE_SYNC))
+    {
+      Count++;
+    }
+    if (Count != 0)
+    {
+      InFlight = Count;
+      DCH0SSA = KVA_TO_PA(&Ring[First]);
+      DCH0SSIZ = Count * sizeof(ES_TraceRecord_t);
+      DCH0CONbits.CHEN = 1;
+      // the TX flag is already up, so kick off the first byte by hand
+      DCH0ECONSET = _DCH0ECON_CFORCE_MASK;
+    }
+  }
+  __builtin_set_isr_state(IntState);
+}
+
+#endif /* _INCLUDE_TRACE_ */
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
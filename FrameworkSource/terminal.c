@@ -16,6 +16,9 @@
  -------------- ---     --------
  08/29/20 14:46 ram     first pass
  10/05/20 19:38 ram     starting work on PIC32 port
+ 11/15/20 14:20 kcao    hold off while the trace buffer is draining
+ 11/20/20 11:30 kcao    drop the byte if the drain can not finish
+ 11/20/20 13:00 kcao    write the byte anyway, text is never lost
  ***************************************************************************/
 
 /*----------------------------- Include Files -----------------------------*/
@@ -28,6 +31,8 @@
 
 //this module
 #include "terminal.h"
+#include "ES_Configure.h"
+#include "ES_Trace.h"
 /*----------------------------- Module Defines ----------------------------*/
 #define BAUD_CONST 42 // sets up baud rate for 115200
 
@@ -112,6 +117,12 @@ uint8_t Terminal_ReadByte(void)
  ******************************************************************************/
 void Terminal_WriteByte(uint8_t txByte)
 {
+#ifdef _INCLUDE_TRACE_
+  // let the trace DMA finish its block so text never splits a record. With
+  // interrupts off the block can not finish, then the byte goes out anyway:
+  // at worst it splits one record, which TraceDecode shows as raw bytes
+  ES_Trace_WaitDrained();
+#endif
   // wait for the register to empty
   while(U1STAbits.UTXBF)
   {}
@@ -19,12 +19,27 @@ typedef enum
   DisplayInitPState, DisplayAvailable, DisplayBusy
 }DisplayState_t;
 
+// the screen the game is on. With the score, round, time, input and
+// instruction it makes up the view the display draws from
+typedef enum
+{
+  PhaseWelcome, PhaseReady, PhaseInstruction, PhaseGo, PhasePlay,
+  PhaseRoundComplete, PhaseGameComplete
+}DisplayPhase_t;
+
 // Public Function Prototypes
 
 bool InitDisplay(uint8_t Priority);
 bool PostDisplay(ES_Event_t ThisEvent);
 ES_Event_t RunDisplay(ES_Event_t ThisEvent);
 DisplayState_t QueryDisplay(void);
+uint16_t QuerySkippedFrames(void);
+void SetDisplayPhase(DisplayPhase_t Phase);
+void SetDisplayScore(uint16_t score);
+void SetDisplayRound(uint16_t round);
+void SetDisplayTime(uint8_t time);
+void SetDisplayInput(uint8_t input);
+void SetDisplayInstruction(uint16_t instruction);
 void welcomeScreen(void);
 void readyScreen(uint16_t score, uint16_t round);
 void instructionScreen(uint16_t score, uint16_t round, uint16_t instruction);
@@ -33,7 +48,6 @@ void playScreen(uint16_t score, uint8_t time, uint8_t input);
 void roundCompleteScreen(uint16_t score, uint16_t round);
 void gameCompleteScreen(void);
 static void bitUnpack(uint16_t EventParam, uint16_t* score, uint8_t* time, uint8_t* input);
-bool Check4WriteDone(void);
         
 
 #endif /* GameState_H */
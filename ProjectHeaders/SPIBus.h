@@ -0,0 +1,54 @@
+/****************************************************************************
+
+  Header file for the SPI1 bus manager
+
+  The OLED and the Dotstar both hang off SPI1 with different word widths,
+  clock rates and select lines. Each device is described once by an
+  SPIBus_Device_t, and every transfer is an SPIBus_Transaction_t that is
+  queued with SPIBus_Submit. Transactions run back to back from the SPI1
+  interrupt, which reconfigures the module whenever the device changes.
+
+ ****************************************************************************/
+
+#ifndef SPIBus_H
+#define SPIBus_H
+
+#include "ES_Types.h"     /* gets bool and the fixed width types */
+
+// pin value for a device without a select or DC line
+#define SPIBUS_NO_PIN 0
+
+// values for SPIBus_Transaction_t.State
+typedef enum
+{
+  SPIBusFree, SPIBusQueued, SPIBusActive
+}SPIBusState_t;
+
+typedef struct
+{
+  uint8_t Width;              // bits per word: 8, 16 or 32
+  uint8_t Mode;               // SPI mode 0-3 (bit 1 CPOL, bit 0 CPHA)
+  uint16_t Brg;               // SPI1BRG value, SCK = 10MHz / (Brg + 1)
+  uint8_t CsPin;              // hal pin held low during a transaction
+  uint8_t DcPin;              // hal pin set to the transaction's Dc level
+  volatile uint32_t *SdoPps;  // PPS register of the pin SDO1 goes to
+}SPIBus_Device_t;
+
+typedef struct SPIBus_Transaction
+{
+  const SPIBus_Device_t *pDevice;
+  const void *pTx;            // Count words of pDevice->Width bits
+  uint16_t Count;
+  uint8_t Dc;                 // level for the device's DC pin
+  volatile uint8_t State;     // SPIBusState_t, owned by SPIBus
+  void (*Done)(void);         // called from the SPI interrupt, may be NULL
+  struct SPIBus_Transaction *pNext; // owned by SPIBus
+}SPIBus_Transaction_t;
+
+// Public Function Prototypes
+
+void SPIBus_Init(void);
+bool SPIBus_Submit(SPIBus_Transaction_t *pTransaction);
+bool SPIBus_IsBusy(void);
+
+#endif /* SPIBus_H */
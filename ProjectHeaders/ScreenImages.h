@@ -0,0 +1,52 @@
+/****************************************************************************
+
+  Header file for the static screen backgrounds
+
+  Each image is a full 128x64 u8g2 buffer (8 pages of 128 column bytes,
+  LSB at the top) holding the parts of a screen that never change. They
+  are generated by Tools/ScreenGen and copied into the buffer with
+  u8g2_ComposeBuffer.
+
+  A sprite is a page aligned piece of the screen in two versions, drawn
+  with u8g2_DrawPageBitmap. Because it starts on a page boundary each of
+  its pages is a single copy into the buffer.
+
+  The digit atlas holds the digits of the screen font, prerendered for
+  u8g2_DrawDigits.
+
+ ****************************************************************************/
+
+#ifndef ScreenImages_H
+#define ScreenImages_H
+
+#include <stdint.h>
+#include "../u8g2Headers/u8g2.h"
+
+#define SCREEN_IMAGE_SIZE (128 * 8)
+#define NUM_ARROW_SPRITES 9
+
+typedef struct
+{
+  uint8_t x;
+  uint8_t Page;               // top row is 8 * Page
+  uint8_t w;                  // 0 for an empty sprite
+  uint8_t Pages;
+  const uint8_t *pNormal;     // Pages pages of w column bytes
+  const uint8_t *pInverted;
+}Sprite_t;
+
+extern const uint8_t WelcomeImage[SCREEN_IMAGE_SIZE];
+extern const uint8_t ReadyImage[SCREEN_IMAGE_SIZE];
+extern const uint8_t GoImage[SCREEN_IMAGE_SIZE];
+extern const uint8_t ArrowsImage[SCREEN_IMAGE_SIZE];
+extern const uint8_t DefusedImage[SCREEN_IMAGE_SIZE];
+extern const uint8_t GameOverImage[SCREEN_IMAGE_SIZE];
+
+// indexed by instruction/input, the arrows for it as they are in
+// ArrowsImage and highlighted
+extern const Sprite_t ArrowSprites[NUM_ARROW_SPRITES];
+
+// digits 0 to 9 and a blank, for the high scores
+extern const u8g2_digit_atlas_t DigitAtlas;
+
+#endif /* ScreenImages_H */
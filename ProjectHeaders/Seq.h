@@ -36,6 +36,7 @@ typedef enum{
 bool InitSequence(uint8_t Priority);
 bool PostSequence(ES_Event_t ThisEvent);
 ES_Event_t RunSequence(ES_Event_t ThisEvent);
+SequenceState_t QuerySequence(void);
 
 //Event Checker
 bool xyVal (void);
@@ -0,0 +1,26 @@
+/****************************************************************************
+  Trace point ids for ES_TRACE() and the text Tools/TraceDecode prints for
+  each of them. The list is shared with the decoder so the two can not drift
+  apart; add new ids at the end so old captures still decode.
+ ****************************************************************************/
+
+#ifndef TraceIds_H
+#define TraceIds_H
+
+#define TRACE_ID_LIST \
+  TRACE_ID(TR_SEQ_ENTRY,      "sequence[%u] = %u") \
+  TRACE_ID(TR_DIRECTION,      "Direction %u (step %u)") \
+  TRACE_ID(TR_GAMEPLAY,       "Gameplay Screen, score %u, %u seconds") \
+  TRACE_ID(TR_SECONDS_LEFT,   "%u seconds remaining, score %u") \
+  TRACE_ID(TR_GAME_OVER,      "Game Over (%u: 0 timeout, 1 incorrect input), score %u") \
+  TRACE_ID(TR_JOYSTICK_ADC,   "ADC %u     ADC %u")
+
+typedef enum
+{
+#define TRACE_ID(Name, Format) Name,
+  TRACE_ID_LIST
+#undef TRACE_ID
+  NUM_TRACE_IDS
+}TraceId_t;
+
+#endif /* TraceIds_H */
@@ -15,6 +15,36 @@
  When           Who     What/Why
  -------------- ---     --------
  10/28/20 07:59 acg      first pass
+ 11/15/20 16:40 kcao     send only dirty tiles, play updates redraw only
+                         the fields that changed
+ 11/16/20 10:15 kcao     updates go out by DMA, the DMA interrupt posts
+                         ES_UPDATE_COMPLETE instead of Check4WriteDone
+ 11/16/20 15:30 kcao     SPI1 is shared with the Dotstar through SPIBus
+ 11/17/20 09:20 kcao     glyphs are looked up through a font index
+ 11/17/20 14:10 kcao     static parts of the screens come from prebuilt
+                         images in flash, only the fields are drawn
+ 11/17/20 16:00 kcao     highlighting an arrow copies a prebuilt sprite
+ 11/17/20 18:30 kcao     welcome marquee, defused flash and game over
+                         roll-in done by the SSD1306 itself
+ 11/18/20 09:30 kcao     display RAM is written through address windows,
+                         the first frame goes out in one transfer
+ 11/18/20 11:00 kcao     font holds only the glyphs of the run time text
+ 11/18/20 14:20 kcao     round, score and timer are u8x8 text fields sent
+                         without the u8g2 buffer
+ 11/18/20 16:10 kcao     text fields keep their characters per cell, only
+                         changed cells are rendered and sent, alignment
+                         comes from the field
+ 11/18/20 17:30 kcao     numbers without sprintf, high scores drawn from a
+                         prerendered digit atlas
+ 11/19/20 10:00 kcao     DISPLAY_PAGE_BUFFER: screens recorded into a
+                         display list and sent from a 128 byte page buffer
+ 11/19/20 11:30 kcao     buffer and field tiles are double buffered, the
+                         next screen is drawn while the last goes out
+ 11/19/20 13:00 kcao     a screen event with the inputs of the screen last
+                         drawn is skipped and counted, see QuerySkippedFrames
+ 11/19/20 15:00 kcao     screens are drawn from a view the game services
+                         set, at most DISPLAY_FRAME_RATE times a second
+ 11/20/20 13:30 kcao     full buffer build checks for the dirty tiles
 ****************************************************************************/
 /*----------------------------- Include Files -----------------------------*/
 /* include header files for this state machine as well as any machines at the
@@ -24,7 +54,6 @@
 #include <xc.h>
 #include <stdlib.h>
 #include <string.h>
-#include <stdio.h>
 #include <proc/p32mx170f256b.h>
 #include <sys/attribs.h> // for ISR macros
 
@@ -45,32 +74,167 @@
 // My Modules
 #include "Display.h"
 #include "GameState.h"
+#include "ScreenImages.h"
 
 
 
 /*----------------------------- Module Defines ----------------------------*/
+// define to run the display from a 128 byte page buffer instead of the 1 KB
+// full buffer. The screens are then recorded into a display list and drawn
+// page by page, and each update is sent before RunDisplay returns. That
+// takes about 470 bytes (page buffer, list and one set of field tiles)
+// instead of about 2.4 KB (full and back buffer, two sets of field tiles)
+//#define DISPLAY_PAGE_BUFFER
+// the full buffer is sent as dirty tiles, only the page buffer build can
+// leave them out of u8g2
+#if !defined(DISPLAY_PAGE_BUFFER) && !defined(U8G2_WITH_DIRTY_TILES)
+#error "U8G2_WITHOUT_DIRTY_TILES needs DISPLAY_PAGE_BUFFER"
+#endif
+// bytes of recorded drawing, enough for a background and three numbers
+#define DISPLAY_LIST_SIZE 128
+// the full buffer and the field tiles are double buffered: one set is sent
+// while the next frame is drawn into the other
+#ifdef DISPLAY_PAGE_BUFFER
+#define DRAW_SETS 1
+#else
+#define DRAW_SETS 2
+#endif
+// the view is drawn at most this many times a second
+#define DISPLAY_FRAME_RATE 20
+#define FRAME_MS (1000 / DISPLAY_FRAME_RATE)
+// contrast the u8g2 init sequence sets
+#define FULL_CONTRAST 0xCF
+// welcome marquee: " press button" lives in pages 6 and 7
+#define MARQUEE_FIRST_PAGE 6
+#define MARQUEE_LAST_PAGE 7
+// BOMB DEFUSED! flashes inverted
+#define FLASH_STEP_MS 120
+#define FLASH_STEPS 5
+// GAME OVER slides up from ROLL_LINES rows down while fading in
+#define ROLL_STEP_MS 40
+#define ROLL_STEPS 8
+#define ROLL_LINES 32
+// round, score and timer are u8x8 text, 2 tile rows high
+#define FIELD_MAX_TILES 4
+#define FIELD_ROWS 2
+// high scores on the game over screen, behind "1." to "3."
+#define HIGH_SCORE_X 28
+#define HIGH_SCORE_DIGITS 4
+
+/*------------------------------ Module Types -----------------------------*/
+// effects the panel runs by itself, set through a few commands
+typedef enum
+{
+    FxNone, FxFlash, FxRollIn
+}Effect_t;
+
+// what the panel is asked to do besides showing its RAM
+typedef struct
+{
+    uint8_t Contrast;
+    uint8_t StartLine;
+    bool Inverted;
+    bool Scrolling;
+}PanelFx_t;
+
+// which end of its field a text is put against
+typedef enum
+{
+    AlignLeft, AlignRight
+}Align_t;
+
+// text drawn by u8x8 straight into display RAM, outside the u8g2 buffer.
+// A field is a row of character cells that remembers the character in
+// each cell. While it is shown u8g2 leaves its tiles alone, and a new
+// score or time only renders and sends the cells whose character changed
+typedef struct
+{
+    uint8_t x;                  // left tile
+    uint8_t y;                  // top tile row
+    uint8_t w;                  // cells, one tile wide, up to FIELD_MAX_TILES
+    Align_t Align;
+    bool Wanted;                // the current screen has this field
+    bool Shown;                 // its tiles on the panel are the field's
+    uint8_t ChangedCells;       // bit n: cell n differs from the panel
+    char Cells[FIELD_MAX_TILES];    // 0 until a cell is rendered
+    uint8_t Tiles[DRAW_SETS][FIELD_ROWS * FIELD_MAX_TILES * 8];
+}TextField_t;
+
+// everything a screen is drawn from. A frame whose view is the same as the
+// one last drawn changes nothing on the panel
+typedef struct
+{
+    DisplayPhase_t Phase;
+    uint16_t score;
+    uint16_t round;
+    uint8_t time;
+    uint8_t input;
+    uint16_t instruction;
+}Frame_t;
 
 /*---------------------------- Module Functions ---------------------------*/
 /* prototypes for private functions for this machine.They should be functions
    relevant to the behavior of this state machine
 */
+static void drawBackground(const uint8_t *pImage);
+static void showStatus(uint16_t score, uint16_t round);
+static void showField(TextField_t *pField, const char *pText);
+static void sendFields(uint32_t RedrawnPages);
+static void drawHighlight(uint8_t input, bool Highlighted);
+static void drawSprite(const Sprite_t *pSprite, bool Inverted);
+static void drawDigits(uint8_t x, uint8_t y, uint16_t Value);
+static void markDirty(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+static void releaseFields(void);
+static void applyEvent(ES_Event_t ThisEvent);
+static void requestFrame(void);
+static bool drawView(void);
+static void startUpdate(void);
+static void presentFrame(void);
+static void startEffect(Effect_t Effect);
+static void stepEffect(void);
+static void resetEffects(void);
+static void updateDone(void);
 
 /*---------------------------- Module Variables ---------------------------*/
 // everybody needs a state variable, you may need others as well.
 // type of state variable should match that of enum in header file
 static DisplayState_t CurrentState;
-static uint8_t LastDisplayState;
-
-// keep track of values needing to be written on the display
-static uint16_t score = 1234;
-static uint8_t time = 15;
-static uint8_t input = 8;
-static uint16_t round = 1;
-static uint16_t instruction;
+
+// what the game wants on the display, set through the SetDisplay functions
+static Frame_t View = { PhaseWelcome, 1234, 1, 15, 8, 0 };
+// the frame timer is running to draw a change to the view
+static bool FrameRequested = false;
 uint16_t score1;
 uint16_t score2;
 uint16_t score3;
 
+// what the play screen currently shows, so an update only redraws changes
+static bool PlayScreenDrawn = false;
+static uint8_t DrawnInput;
+
+// round top left, score top right, timer bottom right
+static TextField_t RoundField = { 0, 0, 3, AlignLeft };
+static TextField_t ScoreField = { 12, 0, 4, AlignRight };
+static TextField_t TimeField = { 14, 6, 2, AlignRight };
+static TextField_t *const Fields[] = { &RoundField, &ScoreField, &TimeField };
+// the set of field tiles the fields are rendered into
+static uint8_t DrawSet = 0;
+
+// a frame has been drawn while the last update was still going out
+static bool FramePending = false;
+
+// the view last drawn, and how many frames had nothing new to draw
+static Frame_t LastFrame;
+static bool FrameDrawn = false;
+static uint16_t SkippedFrames = 0;
+
+// panel effects: what they want and what the panel was last sent
+static const PanelFx_t NoFx = { FULL_CONTRAST, 0, false, false };
+static PanelFx_t WantedFx;
+static PanelFx_t SentFx;
+static Effect_t CurrentEffect = FxNone;
+static uint8_t EffectStep;
+
 // with the introduction of Gen2, we need a module level Priority var as well
 static uint8_t MyPriority;
 
@@ -78,9 +242,19 @@ static uint8_t MyPriority;
 extern uint8_t u8x8_pic32_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 extern uint8_t u8x8_byte_pic32_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 static u8g2_t u8g2;
+#ifdef DISPLAY_PAGE_BUFFER
+// the current screen, replayed for every page that has to go out
+static uint8_t DisplayListBuffer[DISPLAY_LIST_SIZE];
+static u8g2_dl_t DisplayList;
+// end of the background, the arrow highlight is recorded behind it
+static uint16_t BackgroundMark;
+#else
+// the full buffer that is not being drawn into, see u8g2_SwapBuffer
+static uint8_t BackBuffer[SCREEN_IMAGE_SIZE];
+#endif
 
-// add a deferral queue for up to 2 pending deferrals to allow for overhead
-static ES_Event_t DeferralQueue[2];
+// add a deferral queue for an effect step, the screens come from the view
+static ES_Event_t DeferralQueue[1 + 1];
 /*------------------------------ Module Code ------------------------------*/
 /****************************************************************************
  Function
@@ -174,19 +348,34 @@ ES_Event_t RunDisplay(ES_Event_t ThisEvent)
       {
         SPI_Init(); //initialize SPI1
         //build up the u8g2 structure with the proper values for our display
+#ifdef DISPLAY_PAGE_BUFFER
+        u8g2_Setup_ssd1306_128x64_noname_1(&u8g2, U8G2_R0, u8x8_byte_pic32_hw_spi, 
+                                   u8x8_pic32_gpio_and_delay);
+        u8g2_InitDisplayList(&DisplayList, DisplayListBuffer, 
+                             sizeof(DisplayListBuffer));
+#else
         u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, u8x8_byte_pic32_hw_spi, 
                                    u8x8_pic32_gpio_and_delay);
+        u8g2_SetBackBuffer(&u8g2, BackBuffer);
+#endif
         // pass all that stuff on to the display to initialize it
         u8g2_InitDisplay(&u8g2);
         // turn off power save so that the display will be on
         u8g2_SetPowerSave(&u8g2, 0);
-        // choose the font. this one is mono-spaced and has reasonable size
-        u8g2_SetFont(&u8g2, u8g2_font_t0_18_mr);
-        // overwrite the background color of newly written characters
-        u8g2_SetFontMode(&u8g2, 0);
+        // all other text is in the screen images, the high score digits
+        // come from DigitAtlas (ScreenImages.h)
+        // round, score and timer: 7x14 glyphs in 8x16 cells
+        u8x8_SetFont(u8g2_GetU8x8(&u8g2), u8x8_font_7x14_1x2_r);
 
-        //set display state value for event checker
-        LastDisplayState = u8g2_NextPage(&u8g2);
+        // blank the display RAM before the first screen goes up
+#ifdef DISPLAY_PAGE_BUFFER
+        u8g2_SendDisplayList(&u8g2, &DisplayList);
+#else
+        u8g2_SendFrame(&u8g2);
+#endif
+        // the init sequence leaves the panel without effects
+        WantedFx = NoFx;
+        SentFx = NoFx;
 
         //transition to available state
         CurrentState = DisplayAvailable;
@@ -197,49 +386,28 @@ ES_Event_t RunDisplay(ES_Event_t ThisEvent)
     /*---------------------------------------------------- DisplayAvailable*/   
     case DisplayAvailable:        
     {
-        if (ThisEvent.EventType == ES_DISPLAY_WELCOME)
-        {
-            welcomeScreen();                    // display welcome screen
-            CurrentState = DisplayBusy;         // transition to busy state
-        }
-                
-        if (ThisEvent.EventType == ES_DISPLAY_READY)
-        {
-            round = ThisEvent.EventParam;       // update round
-            readyScreen(score, round);          // display ready screen
-            CurrentState = DisplayBusy;         // transition to busy state
-        }
-        
-        if (ThisEvent.EventType == ES_DISPLAY_INSTRUCTION)
-        {
-            instruction = ThisEvent.EventParam; // update instruction
-            instructionScreen(score, round, instruction); // display instruction screen
-            CurrentState = DisplayBusy;         //transition to busy state
-        }
-        
-        if (ThisEvent.EventType == ES_DISPLAY_GO)
+        if ((ThisEvent.EventType == ES_TIMEOUT) && 
+                (ThisEvent.EventParam == FRAME_TIMER))
         {
-            goScreen(score, round);             // display go screen
-            CurrentState = DisplayBusy;         // transition to busy state
+            FrameRequested = false;
+            if (drawView())                     // draw the view if it changed
+            {
+                CurrentState = DisplayBusy;     // transition to busy state
+            }
         }
         
-        if (ThisEvent.EventType == ES_DISPLAY_PLAY_UPDATE)
+        else if ((ThisEvent.EventType == ES_TIMEOUT) && 
+                (ThisEvent.EventParam == FX_TIMER) && 
+                (CurrentEffect != FxNone))
         {
-            bitUnpack(ThisEvent.EventParam, &score, &time, &input);
-            playScreen(score, time, input);     // display play screen
+            stepEffect();                       // next step of the effect
+            startUpdate();                      // send its commands
             CurrentState = DisplayBusy;         // transition to busy state
         }
         
-        if (ThisEvent.EventType == ES_DISPLAY_ROUNDCOMPLETE)
+        else
         {
-            roundCompleteScreen(score, round);  // display round complete screen
-            CurrentState = DisplayBusy;         // transition to busy state
-        }
-        
-        if (ThisEvent.EventType == ES_DISPLAY_GAMECOMPLETE)
-        {
-            gameCompleteScreen();               // display game complete screen
-            CurrentState = DisplayBusy;         // transition to busy state
+            applyEvent(ThisEvent);              // screen events set the view
         }
     }
     break;
@@ -249,40 +417,56 @@ ES_Event_t RunDisplay(ES_Event_t ThisEvent)
     {
         if (ThisEvent.EventType == ES_UPDATE_COMPLETE)
         {
-            //recall the deferred event 
-            ES_RecallEvents(MyPriority, DeferralQueue); 
-            //transition to available state
-            CurrentState = DisplayAvailable;
-        }
-        
-        if (ThisEvent.EventType == ES_DISPLAY_WELCOME)
-        {
-            ES_DeferEvent(DeferralQueue, ThisEvent);    // defer event
+            if (FramePending)
+            {
+                // the frame drawn in the meantime goes out now
+                FramePending = false;
+                presentFrame();
+            }
+            else
+            {
+                //recall the deferred event 
+                ES_RecallEvents(MyPriority, DeferralQueue); 
+                //transition to available state
+                CurrentState = DisplayAvailable;
+            }
         }
         
-        if (ThisEvent.EventType == ES_DISPLAY_READY)
+        else if ((ThisEvent.EventType == ES_TIMEOUT) && 
+                (ThisEvent.EventParam == FRAME_TIMER))
         {
-            ES_DeferEvent(DeferralQueue, ThisEvent);    // defer event
+            if (!FramePending)
+            {
+                // draw the next frame while the last one is still going
+                // out, startUpdate keeps it until the transfer is done
+                FrameRequested = false;
+                drawView();
+            }
+            else
+            {
+                // two frames are in flight already, try again next frame
+                ES_Timer_InitTimer(FRAME_TIMER, FRAME_MS);
+            }
         }
         
-        if (ThisEvent.EventType == ES_DISPLAY_INSTRUCTION)
+        else if ((ThisEvent.EventType == ES_TIMEOUT) && 
+                (ThisEvent.EventParam == FX_TIMER) && 
+                (CurrentEffect != FxNone))
         {
-            ES_DeferEvent(DeferralQueue, ThisEvent);    // defer event
+            if (!FramePending)
+            {
+                stepEffect();                   // next step of the effect
+                startUpdate();                  // send its commands
+            }
+            else
+            {
+                ES_DeferEvent(DeferralQueue, ThisEvent);    // defer event
+            }
         }
         
-        if (ThisEvent.EventType == ES_DISPLAY_PLAY_UPDATE)
+        else
         {
-            ES_DeferEvent(DeferralQueue, ThisEvent);    // defer event
-        }
-        
-        if (ThisEvent.EventType == ES_DISPLAY_ROUNDCOMPLETE)
-        {
-            ES_DeferEvent(DeferralQueue, ThisEvent);    // defer event
-        }
-        
-        if (ThisEvent.EventType == ES_DISPLAY_GAMECOMPLETE)
-        {
-            ES_DeferEvent(DeferralQueue, ThisEvent);    // defer event
+            applyEvent(ThisEvent);              // screen events set the view
         }
     }
     break;
@@ -316,677 +500,675 @@ DisplayState_t QueryDisplay(void)
     return CurrentState;
 }
 
+/****************************************************************************
+ Function
+     QuerySkippedFrames
+
+ Parameters
+     None
+
+ Returns
+     uint16_t the number of frames skipped so far
+
+ Description
+     returns how many frames found the view as it was last drawn, with the
+     same screen, score, round, time, input and instruction. These are
+     neither drawn nor sent
+ Notes
+
+ Author
+    K Cao, 11/19/20
+****************************************************************************/
+uint16_t QuerySkippedFrames(void)
+{
+    return SkippedFrames;
+}
+
+/****************************************************************************
+ Function
+     SetDisplayPhase, SetDisplayScore, SetDisplayRound, SetDisplayTime,
+     SetDisplayInput, SetDisplayInstruction
+
+ Parameters
+     the new value of that part of the view
+
+ Returns
+     None
+
+ Description
+     update the view the display draws from. Nothing is drawn here: a
+     change starts the frame timer, and the view as it is when that runs
+     out is drawn once, however many changes came in meanwhile
+ Notes
+     cheap enough to call on every change, from any service
+ Author
+    K Cao, 11/19/20
+****************************************************************************/
+void SetDisplayPhase(DisplayPhase_t Phase)
+{
+    View.Phase = Phase;
+    requestFrame();
+}
+
+void SetDisplayScore(uint16_t score)
+{
+    View.score = score;
+    requestFrame();
+}
+
+void SetDisplayRound(uint16_t round)
+{
+    View.round = round;
+    requestFrame();
+}
+
+void SetDisplayTime(uint8_t time)
+{
+    View.time = time;
+    requestFrame();
+}
+
+void SetDisplayInput(uint8_t input)
+{
+    View.input = input;
+    requestFrame();
+}
+
+void SetDisplayInstruction(uint16_t instruction)
+{
+    View.instruction = instruction;
+    requestFrame();
+}
+
 /***************************************************************************
  private functions
  ***************************************************************************/
 //Creates and displays the Welcome 
 void welcomeScreen(void)
 {
-    // clear screen
-    u8g2_FirstPage(&u8g2); 
-    // write game name to display
-    u8g2_DrawStr(&u8g2, 1, 15, " KEEP COPYING "); 
-    u8g2_DrawStr(&u8g2, 1, 30, "  AND NOBODY  "); 
-    u8g2_DrawStr(&u8g2, 1, 45, "   EXPLODES   ");
-    // write start instructions to display
-    u8g2_DrawStr(&u8g2, 1, 60, " press button");
-    // set last display state to busy
-    LastDisplayState = 1;    
+    // game name and start instructions, nothing else on this screen
+    drawBackground(WelcomeImage);
+    // the panel scrolls the start instructions by itself
+    WantedFx.Scrolling = true;
+    // send the changed tiles to the display
+    startUpdate();
 }
 
 // Creates and displays the Ready screen
 void readyScreen(uint16_t score, uint16_t round)
 {
-    // turn round into a string and add it to "R"
-    char roundstring[4];
-    sprintf(roundstring, "R%i", round);
-    
-    // turn score into a string
-    char scorestring[5];
-    sprintf(scorestring, "%i", score);
-    
-    // clear screen
-    u8g2_FirstPage(&u8g2); 
-    // write READY to the display
-    u8g2_DrawStr(&u8g2, 45, 40, "READY");
-    // write the round number to the display
-    u8g2_DrawStr(&u8g2, 1, 15, roundstring); 
-    // write the score to the display, align text with left side
-    if (score < 10)
-    {
-        u8g2_DrawStr(&u8g2, 120, 15, scorestring);
-    }
-    else if ((score >= 10) && (score < 100))
-    {
-        u8g2_DrawStr(&u8g2, 110, 15, scorestring);
-    }
-    else if ((score >= 100) && (score < 1000))
-    {
-        u8g2_DrawStr(&u8g2, 100, 15, scorestring);
-    }
-    else
-    {
-        u8g2_DrawStr(&u8g2, 90, 15, scorestring);
-    }
-    // set last display state to busy
-    LastDisplayState = 1;
+    // READY comes with the background
+    drawBackground(ReadyImage);
+    // round and score go straight to the panel as text
+    showStatus(score, round);
+    // send the changed tiles to the display
+    startUpdate();
 }
 
 // Creates and displays the Instruction screen
 void instructionScreen(uint16_t score, uint16_t round, uint16_t instruction)
 {
-    // turn round into a string and add it to "R"
-    char roundstring[4];
-    sprintf(roundstring, "R%i", round);
+    // the arrow cross comes with the background
+    drawBackground(ArrowsImage);
+    // round and score go straight to the panel as text
+    showStatus(score, round);
     
-    // turn score into a string
-    char scorestring[5];
-    sprintf(scorestring, "%i", score);
+    // highlight the arrows for the direction
+    drawHighlight(instruction, true);
     
-    // clear screen
-    u8g2_FirstPage(&u8g2); 
-    // write the round number to the display
-    u8g2_DrawStr(&u8g2, 1, 15, roundstring); 
-    // write the score to the display, align text with left side
-    if (score < 10)                                 //score is 1 number wide
+    // send the changed tiles to the display
+    startUpdate();
+}
+
+// Creates and displays the Go screen
+void goScreen(uint16_t score, uint16_t round)
+{
+    // GO! comes with the background
+    drawBackground(GoImage);
+    // round and score go straight to the panel as text
+    showStatus(score, round);
+    // send the changed tiles to the display
+    startUpdate();
+}
+
+// Creates and displays the Play screen
+void playScreen(uint16_t score, uint8_t time, uint8_t input)
+{
+    // turn time into a string, blank beyond 15
+    char timestring[3] = "";
+    if (time <= 15)
     {
-        u8g2_DrawStr(&u8g2, 120, 15, scorestring);
+        u8x8_u16toar(timestring, time, 2);
     }
-    else if ((score >= 10) && (score < 100))        // score is 2 numbers wide
+    
+    // only draw the whole screen when coming from another screen, after that
+    // only what changed goes out: the text fields send themselves when
+    // their text is new, the highlight is a few tiles of the buffer
+    if (PlayScreenDrawn == false)
     {
-        u8g2_DrawStr(&u8g2, 110, 15, scorestring);
+        // the arrow cross comes with the background
+        drawBackground(ArrowsImage);
     }
-    else if ((score >= 100) && (score < 1000))      // score is 3 numbers wide
+    // multiply score by 10 for the display
+    showStatus(10*score, View.round);
+    showField(&TimeField, timestring);
+    
+    // move the highlight: put the old arrows back as they are in the
+    // background, then copy in the highlighted new ones
+    if (PlayScreenDrawn == false)
     {
-        u8g2_DrawStr(&u8g2, 100, 15, scorestring);
+        drawHighlight(input, true);
+        DrawnInput = input;
     }
-    else                                            // score is 4 numbers wide
+    else if (input != DrawnInput)
     {
-        u8g2_DrawStr(&u8g2, 90, 15, scorestring);
+        drawHighlight(DrawnInput, false);
+        drawHighlight(input, true);
+        DrawnInput = input;
     }
     
-    // write the direction to the screen
-    if (instruction == 0)   // LEFT
+    PlayScreenDrawn = true;
+    // send the changed tiles to the display
+    startUpdate();
+}
+
+// Draws the arrows for input highlighted, or as they are in ArrowsImage
+static void drawHighlight(uint8_t input, bool Highlighted)
+{
+    if (input < NUM_ARROW_SPRITES)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-           
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0); 
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1); 
-                    
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow  
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        drawSprite(&ArrowSprites[input], Highlighted);
     }
-    
-    if (instruction == 1)   // SUPER LEFT
+}
+
+// Copies a sprite into the buffer. Sprites start on a page boundary, so
+// each page of one is a straight copy of w bytes
+static void drawSprite(const Sprite_t *pSprite, bool Inverted)
+{
+    if (pSprite->w == 0)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0); 
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
-                               
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        return;
     }
-    
-    if (instruction == 2)   // RIGHT
+#ifdef DISPLAY_PAGE_BUFFER
+    // the sprites behind the background are the highlight: putting the
+    // arrows back as they are in the background is dropping it
+    if (!Inverted)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);                
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1); 
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow  
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        u8g2_RewindDisplayList(&DisplayList, BackgroundMark);
+        return;
     }
+    u8g2_RecordPageBitmap(&u8g2, &DisplayList, pSprite->x, 8 * pSprite->Page, 
+                          pSprite->w, 8 * pSprite->Pages, pSprite->pInverted);
+#else
+    u8g2_DrawPageBitmap(&u8g2, pSprite->x, 8 * pSprite->Page, pSprite->w,
+                        8 * pSprite->Pages,
+                        Inverted ? pSprite->pInverted : pSprite->pNormal);
+#endif
+}
+
+// Draws a high score right aligned in its digit cells, baseline at y
+static void drawDigits(uint8_t x, uint8_t y, uint16_t Value)
+{
+#ifdef DISPLAY_PAGE_BUFFER
+    u8g2_RecordDigits(&u8g2, &DisplayList, x, y, &DigitAtlas, Value, 
+                      HIGH_SCORE_DIGITS);
+#else
+    u8g2_DrawDigits(&u8g2, x, y, &DigitAtlas, Value, HIGH_SCORE_DIGITS);
+#endif
+}
+
+// Creates and displays the Round Complete screen
+void roundCompleteScreen(uint16_t score, uint16_t round)
+{
+    // BOMB DEFUSED! comes with the background, and flashes
+    drawBackground(DefusedImage);
+    startEffect(FxFlash);
+    // round and score go straight to the panel as text
+    showStatus(score, round);
     
-    if (instruction == 3)   // SUPER RIGHT
-    {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);                
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);   
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-    }
+    // send the changed tiles to the display
+    startUpdate();
+}
+
+// Creates and displays the Game Complete screen
+void gameCompleteScreen(void)
+{
+    // GAME OVER and the High Scores title come with the background, the
+    // whole screen slides up into place and fades in
+    drawBackground(GameOverImage);
+    startEffect(FxRollIn);
     
-    if (instruction == 4)   // UP
-    {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0); 
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-    }
+    //get high score values
+    queryHighScores(&score1, &score2, &score3);
     
-    if (instruction == 5)   // SUPER UP
-    {
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);  
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-    }
+    // write the high score values behind their places, right aligned
+    drawDigits(HIGH_SCORE_X, 30, score1);
+    drawDigits(HIGH_SCORE_X, 45, score2);
+    drawDigits(HIGH_SCORE_X, 60, score3);
     
-    if (instruction == 6)   // DOWN
-    {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-    }
+    // send the changed tiles to the display
+    startUpdate();
+}
+
+// Replaces the whole buffer with a prebuilt background, only the tiles that
+// differ from what is on the display get marked for sending. The next play
+// update has to redraw everything
+static void drawBackground(const uint8_t *pImage)
+{
+    uint8_t i;
     
-    if (instruction == 7)   // SUPER DOWN
+    resetEffects();
+#ifdef DISPLAY_PAGE_BUFFER
+    // a new screen: every page is drawn and sent again
+    u8g2_ClearDisplayList(&DisplayList);
+    u8g2_RecordImage(&u8g2, &DisplayList, pImage, U8G2_ROP_COPY);
+    BackgroundMark = u8g2_GetDisplayListMark(&DisplayList);
+#else
+    u8g2_ComposeBuffer(&u8g2, pImage, U8G2_ROP_COPY);
+#endif
+    PlayScreenDrawn = false;
+    // the screen shows the fields it wants again
+    for (i = 0; i < sizeof(Fields) / sizeof(Fields[0]); i++)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
+        Fields[i]->Wanted = false;
     }
-    
-    // set last display state to busy
-    LastDisplayState = 1;
 }
 
-// Creates and displays the Go screen
-void goScreen(uint16_t score, uint16_t round)
+// Shows round and score in their fields
+static void showStatus(uint16_t score, uint16_t round)
 {
-    // turn round into a string and add it to "R"
-    char roundstring[4];
-    sprintf(roundstring, "R%i", round);
+    char roundstring[FIELD_MAX_TILES + 1] = "R";
+    char digits[FIELD_MAX_TILES + 1];
+    char scorestring[FIELD_MAX_TILES + 1];
     
-    // turn score into a string
-    char scorestring[5];
-    sprintf(scorestring, "%i", score);
+    strcat(roundstring, u8x8_u16toar(digits, round, RoundField.w - 1));
+    u8x8_u16toar(scorestring, score, ScoreField.w);
+    showField(&RoundField, roundstring);
+    showField(&ScoreField, scorestring);
+}
+
+// Puts a field on the current screen with this text, placed against the
+// field's aligned end and padded with blanks. Only the cells whose
+// character changed are rendered into the field's tiles
+static void showField(TextField_t *pField, const char *pText)
+{
+    uint8_t Length = strlen(pText);
+    uint8_t First;
+    uint8_t i;
+    char c;
     
-    // clear screen
-    u8g2_FirstPage(&u8g2); 
-    // write READY to the display
-    u8g2_DrawStr(&u8g2, 55, 40, "GO!");
-    // write the round number to the display
-    u8g2_DrawStr(&u8g2, 1, 15, roundstring); 
-    // write the score to the display, align text with left side
-    if (score < 10)                                 // score is 1 number wide
+    if (Length > pField->w)
     {
-        u8g2_DrawStr(&u8g2, 120, 15, scorestring);
+        Length = pField->w;
     }
-    else if ((score >= 10) && (score < 100))        // score is 2 numbers wide
+    First = (pField->Align == AlignRight) ? pField->w - Length : 0;
+    pField->Wanted = true;
+    for (i = 0; i < pField->w; i++)
     {
-        u8g2_DrawStr(&u8g2, 110, 15, scorestring);
-    }
-    else if ((score >= 100) && (score < 1000))      // score is 3 numbers wide
-    {
-        u8g2_DrawStr(&u8g2, 100, 15, scorestring);
+        c = ((i >= First) && (i < First + Length)) ? pText[i - First] : ' ';
+        if (c != pField->Cells[i])
+        {
+            u8x8_RenderGlyph(u8g2_GetU8x8(&u8g2), &pField->Tiles[DrawSet][8 * i], 
+                    8 * pField->w, c);
+            pField->Cells[i] = c;
+            pField->ChangedCells |= 1 << i;
+        }
     }
-    else                                            // score is 4 numbers wide
+}
+
+// Gives the tiles of the fields the current screen does not have back to
+// the buffer, they go out with its next transfer
+static void releaseFields(void)
+{
+    TextField_t *pField;
+    uint8_t i;
+    
+    for (i = 0; i < sizeof(Fields) / sizeof(Fields[0]); i++)
     {
-        u8g2_DrawStr(&u8g2, 90, 15, scorestring);
+        pField = Fields[i];
+        if (!pField->Wanted && pField->Shown)
+        {
+            markDirty(8 * pField->x, 8 * pField->y, 8 * pField->w, 
+                    8 * FIELD_ROWS);
+            pField->Shown = false;
+        }
     }
-    // set last display state to busy
-    LastDisplayState = 1;
 }
 
-// Creates and displays the Play screen
-void playScreen(uint16_t score, uint8_t time, uint8_t input)
+// Queues the fields that are new on the panel, each as one window of its
+// own tiles, and the changed cells of the fields already there. u8g2 is
+// kept off the tiles of the shown fields. A field on one of the
+// RedrawnPages has been overwritten by the buffer and goes out again
+static void sendFields(uint32_t RedrawnPages)
 {
-    // turn round into a string and add it to "R"
-    char roundstring[4];
-    sprintf(roundstring, "R%i", round);
-    
-    // multiply score by 10 and turn score into a string
-    score = 10*score;
-    char scorestring[5];
-    sprintf(scorestring, "%i", score);
+    TextField_t *pField;
+    uint32_t FieldPages;
+    uint8_t First;
+    uint8_t Last;
+    uint8_t i;
     
-    // turn time into a string
-    char timestring[3];
-    sprintf(timestring, "%i", time);
-    
-    // clear screen
-    u8g2_FirstPage(&u8g2); 
-    // write the round number to the display
-    u8g2_DrawStr(&u8g2, 1, 15, roundstring); 
-    
-    // write the time to the display
-    if (time < 10)                                  // time is 1 number wide
+    for (i = 0; i < sizeof(Fields) / sizeof(Fields[0]); i++)
     {
-        u8g2_DrawStr(&u8g2, 120, 60, timestring); 
+        pField = Fields[i];
+        if (!pField->Wanted)
+        {
+            continue;
+        }
+        FieldPages = ((1UL << FIELD_ROWS) - 1) << pField->y;
+        if (!pField->Shown || ((RedrawnPages & FieldPages) != 0))
+        {
+            pField->ChangedCells = (1 << pField->w) - 1;
+        }
+        if (pField->ChangedCells != 0)
+        {
+            // one window from the first to the last changed cell
+            First = 0;
+            while ((pField->ChangedCells & (1 << First)) == 0)
+            {
+                First++;
+            }
+            Last = pField->w - 1;
+            while ((pField->ChangedCells & (1 << Last)) == 0)
+            {
+                Last--;
+            }
+            u8x8_DrawWindow(u8g2_GetU8x8(&u8g2), pField->x + First, 
+                    pField->y, Last - First + 1, FIELD_ROWS, 
+                    &pField->Tiles[DrawSet][8 * First], 8 * pField->w);
+        }
+#ifndef DISPLAY_PAGE_BUFFER
+        u8g2_ClearDirtyTiles(&u8g2, pField->x, pField->y, pField->w, 
+                FIELD_ROWS);
+#endif
+        pField->ChangedCells = 0;
+        pField->Shown = true;
     }
-    if ((time >= 10) && (time <= 15))               // time is 2 numbers wide
+}
+
+// Sets the view from a screen event, for the services that still post them
+static void applyEvent(ES_Event_t ThisEvent)
+{
+    uint16_t score;
+    uint8_t time;
+    uint8_t input;
+    
+    if (ThisEvent.EventType == ES_DISPLAY_WELCOME)
     {
-        u8g2_DrawStr(&u8g2, 110, 60, timestring); 
+        SetDisplayPhase(PhaseWelcome);
     }
     
-    // write the score to the display, align text with left side
-    if (score < 10)                                 //score is 1 number wide
+    else if (ThisEvent.EventType == ES_DISPLAY_READY)
     {
-        u8g2_DrawStr(&u8g2, 120, 15, scorestring);
+        SetDisplayRound(ThisEvent.EventParam);
+        SetDisplayPhase(PhaseReady);
     }
-    else if ((score >= 10) && (score < 100))        // score is 2 numbers wide
+    
+    else if (ThisEvent.EventType == ES_DISPLAY_INSTRUCTION)
     {
-        u8g2_DrawStr(&u8g2, 110, 15, scorestring);
+        SetDisplayInstruction(ThisEvent.EventParam);
+        SetDisplayPhase(PhaseInstruction);
     }
-    else if ((score >= 100) && (score < 1000))      // score is 3 numbers wide
+    
+    else if (ThisEvent.EventType == ES_DISPLAY_GO)
     {
-        u8g2_DrawStr(&u8g2, 100, 15, scorestring);
+        SetDisplayPhase(PhaseGo);
     }
-    else                                            // score is 4 numbers wide
+    
+    else if (ThisEvent.EventType == ES_DISPLAY_PLAY_UPDATE)
     {
-        u8g2_DrawStr(&u8g2, 90, 15, scorestring);
+        bitUnpack(ThisEvent.EventParam, &score, &time, &input);
+        SetDisplayScore(score);
+        SetDisplayTime(time);
+        SetDisplayInput(input);
+        SetDisplayPhase(PhasePlay);
     }
     
-    // write the direction to the screen
-    if (input == 0)   // LEFT
+    else if (ThisEvent.EventType == ES_DISPLAY_ROUNDCOMPLETE)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-           
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0); 
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1); 
-                    
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow  
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        SetDisplayPhase(PhaseRoundComplete);
     }
     
-    if (input == 1)   // SUPER LEFT
+    else if (ThisEvent.EventType == ES_DISPLAY_GAMECOMPLETE)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0); 
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
-                               
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        SetDisplayPhase(PhaseGameComplete);
     }
-    
-    if (input == 2)   // RIGHT
+}
+
+// Starts the frame timer unless it is already running for an earlier change
+static void requestFrame(void)
+{
+    if (!FrameRequested)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);                
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1); 
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow  
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        FrameRequested = true;
+        ES_Timer_InitTimer(FRAME_TIMER, FRAME_MS);
     }
-    
-    if (input == 3)   // SUPER RIGHT
+}
+
+// Draws the screen of the view, false if it is the same as the one last
+// drawn
+static bool drawView(void)
+{
+    if (FrameDrawn && 
+            (View.Phase == LastFrame.Phase) && 
+            (View.score == LastFrame.score) && 
+            (View.round == LastFrame.round) && 
+            (View.time == LastFrame.time) && 
+            (View.input == LastFrame.input) && 
+            (View.instruction == LastFrame.instruction))
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);                
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);   
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        SkippedFrames++;                    // the panel already shows it
+        return false;
     }
+    LastFrame = View;
+    FrameDrawn = true;
     
-    if (input == 4)   // UP
+    switch (View.Phase)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0); 
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
+        case PhaseWelcome:
+        {
+            welcomeScreen();
+        }
+        break;
         
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
+        case PhaseReady:
+        {
+            readyScreen(View.score, View.round);
+        }
+        break;
         
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-    }
-    
-    if (input == 5)   // SUPER UP
-    {
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);  
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
+        case PhaseInstruction:
+        {
+            instructionScreen(View.score, View.round, View.instruction);
+        }
+        break;
         
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
+        case PhaseGo:
+        {
+            goScreen(View.score, View.round);
+        }
+        break;
         
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-    }
-    
-    if (input == 6)   // DOWN
-    {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        case PhasePlay:
+        {
+            playScreen(View.score, View.time, View.input);
+        }
+        break;
         
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
+        case PhaseRoundComplete:
+        {
+            roundCompleteScreen(View.score, View.round);
+        }
+        break;
         
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        default:
+        {
+            gameCompleteScreen();
+        }
+        break;
     }
-    
-    if (input == 7)   // SUPER DOWN
+    return true;
+}
+
+// Marks a box of the screen to be drawn and sent with the next update
+static void markDirty(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+#ifdef DISPLAY_PAGE_BUFFER
+    u8g2_MarkDisplayListRows(&DisplayList, y, h);
+#else
+    u8g2_MarkDirtyBox(&u8g2, x, y, w, h);
+#endif
+}
+
+// Sends the screen just drawn, or keeps it until the update still going
+// out is done. Either way the next screen can be drawn right away
+static void startUpdate(void)
+{
+    if (CurrentState == DisplayBusy)
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        // highlight on
-        u8g2_SetFontMode(&u8g2, 0);   
-        u8g2_SetDrawColor(&u8g2, 0);
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        // highlight off
-        u8g2_SetFontMode(&u8g2, 0);                 
-        u8g2_SetDrawColor(&u8g2, 1);
+        FramePending = true;
     }
-    
-    if (input == 8)   // BLANK
+    else
     {
-        u8g2_SetFontDirection(&u8g2, 3);            // font direction 270 deg
-        u8g2_DrawStr(&u8g2, 65, 15, ">");           // super up arrow
-        u8g2_DrawStr(&u8g2, 65, 25, ">");           // up arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
-        
-        u8g2_DrawStr(&u8g2, 28, 40, "<");           // super left arrow
-        u8g2_DrawStr(&u8g2, 38, 40, "<");           // left arrow
-                      
-        u8g2_DrawStr(&u8g2, 75, 40, ">");           // right arrow
-        u8g2_DrawStr(&u8g2, 85, 40, ">");           // super right arrow
-        
-        u8g2_SetFontDirection(&u8g2, 1);            // font direction 90 deg
-        u8g2_DrawStr(&u8g2, 55, 45, ">");           // down arrow
-        u8g2_DrawStr(&u8g2, 55, 55, ">");           // super down arrow
-        u8g2_SetFontDirection(&u8g2, 0);            // reset font direction
+        presentFrame();
     }
-    
-    // set last display state to busy
-    LastDisplayState = 1;
 }
 
-// Creates and displays the Round Complete screen
-void roundCompleteScreen(uint16_t score, uint16_t round)
+// Queues the effect commands and the changed tiles on the SPI bus,
+// updateDone runs from the SPI interrupt once the last byte is out. The
+// queued tiles are read in place, so the buffer and the field tiles are
+// swapped afterwards and drawing goes on in the other set. With the page
+// buffer the pages are drawn into the same 128 bytes one after the other,
+// so everything is sent right away instead
+static void presentFrame(void)
 {
-    // turn round into a string and add it to "R"
-    char roundstring[4];
-    sprintf(roundstring, "R%i", round);
-    
-    // turn score into a string
-    char scorestring[5];
-    sprintf(scorestring, "%i", score);
+#ifndef DISPLAY_PAGE_BUFFER
+    TextField_t *pField;
+    uint8_t i;
+#endif
+    u8x8_t *pU8x8 = u8g2_GetU8x8(&u8g2);
+    uint32_t RedrawnPages = 0;
     
-    // clear screen
-    u8g2_FirstPage(&u8g2); 
-    // write READY to the display
-    u8g2_DrawStr(&u8g2, 7, 40, "BOMB DEFUSED!");
-    // write the round number to the display
-    u8g2_DrawStr(&u8g2, 1, 15, roundstring); 
-    // write the score to the display, align text with left side
-    if (score < 10)                                 // score is 1 number wide
+#ifndef DISPLAY_PAGE_BUFFER
+    SPI_QueueBegin();
+#endif
+    // the panel RAM must not be written while it scrolls, and stopping
+    // leaves the scrolled pages moved, so those go out again
+    if (SentFx.Scrolling && !WantedFx.Scrolling)
     {
-        u8g2_DrawStr(&u8g2, 120, 15, scorestring);
+        u8x8_ssd1306_StopScroll(pU8x8);
+        markDirty(0, 8 * MARQUEE_FIRST_PAGE, 128, 
+                8 * (MARQUEE_LAST_PAGE - MARQUEE_FIRST_PAGE + 1));
     }
-    else if ((score >= 10) && (score < 100))        // score is 2 numbers wide
+    if (WantedFx.Inverted != SentFx.Inverted)
     {
-        u8g2_DrawStr(&u8g2, 110, 15, scorestring);
+        u8x8_ssd1306_SetInvert(pU8x8, WantedFx.Inverted);
     }
-    else if ((score >= 100) && (score < 1000))      // score is 3 numbers wide
+    if (WantedFx.Contrast != SentFx.Contrast)
     {
-        u8g2_DrawStr(&u8g2, 100, 15, scorestring);
+        u8x8_SetContrast(pU8x8, WantedFx.Contrast);
     }
-    else                                            // score is 4 numbers wide
+    if (WantedFx.StartLine != SentFx.StartLine)
     {
-        u8g2_DrawStr(&u8g2, 90, 15, scorestring);
+        u8x8_ssd1306_SetStartLine(pU8x8, WantedFx.StartLine);
     }
-    
-    // set last display state to busy
-    LastDisplayState = 1;
+    releaseFields();
+#ifdef DISPLAY_PAGE_BUFFER
+    RedrawnPages = u8g2_SendDisplayList(&u8g2, &DisplayList);
+#endif
+    sendFields(RedrawnPages);
+#ifndef DISPLAY_PAGE_BUFFER
+    u8g2_SendDirtyTiles(&u8g2);
+#endif
+    if (WantedFx.Scrolling && !SentFx.Scrolling)
+    {
+        u8x8_ssd1306_StartScroll(pU8x8, U8X8_SSD1306_SCROLL_LEFT, 
+                MARQUEE_FIRST_PAGE, MARQUEE_LAST_PAGE, 
+                U8X8_SSD1306_SCROLL_FRAMES_4, 0);
+    }
+    SentFx = WantedFx;
+#ifdef DISPLAY_PAGE_BUFFER
+    updateDone();
+#else
+    SPI_QueueStart(updateDone);
+    u8g2_SwapBuffer(&u8g2);
+    for (i = 0; i < sizeof(Fields) / sizeof(Fields[0]); i++)
+    {
+        pField = Fields[i];
+        memcpy(pField->Tiles[DRAW_SETS - 1 - DrawSet], 
+                pField->Tiles[DrawSet], sizeof(pField->Tiles[0]));
+    }
+    DrawSet = DRAW_SETS - 1 - DrawSet;
+#endif
 }
 
-// Creates and displays the Game Complete screen
-void gameCompleteScreen(void)
+// Starts a timed effect, its first step goes out with the screen update
+static void startEffect(Effect_t Effect)
 {
-    // clear screen
-    u8g2_FirstPage(&u8g2); 
-    // write GAME OVER to the display
-    u8g2_DrawStr(&u8g2, 85, 35, "GAME");
-    u8g2_DrawStr(&u8g2, 85, 50, "OVER");
-    // write High Scores to the display
-    u8g2_DrawStr(&u8g2, 1, 12, "High Scores");
-    
-    //get high score values and turn into strings
-    queryHighScores(&score1, &score2, &score3);
-    char score1string[8];
-    sprintf(score1string, "1. %i", score1);
-    char score2string[8];
-    sprintf(score2string, "2. %i", score2);
-    char score3string[8];
-    sprintf(score3string, "3. %i", score3);
-    
-    // write high score values to displayed
-    u8g2_DrawStr(&u8g2, 1, 30, score1string);
-    u8g2_DrawStr(&u8g2, 1, 45, score2string);
-    u8g2_DrawStr(&u8g2, 1, 60, score3string);
-    
-    // set last display state to busy
-    LastDisplayState = 1;
+    CurrentEffect = Effect;
+    EffectStep = 0;
+    stepEffect();
+}
+
+// Sets what the panel should do for the current step of the effect and
+// moves on to the next, the commands go out with the next update
+static void stepEffect(void)
+{
+    switch (CurrentEffect)
+    {
+        case FxFlash:
+        {
+            // inverted on the even steps, the last one is back to normal
+            WantedFx.Inverted = ((EffectStep & 1) == 0) && 
+                    (EffectStep < FLASH_STEPS);
+            if (EffectStep < FLASH_STEPS)
+            {
+                ES_Timer_InitTimer(FX_TIMER, FLASH_STEP_MS);
+            }
+            else
+            {
+                CurrentEffect = FxNone;
+            }
+        }
+        break;
+        
+        case FxRollIn:
+        {
+            // a start line of 64 - n shows the screen n rows lower
+            WantedFx.StartLine = (64 - ROLL_LINES * 
+                    (ROLL_STEPS - EffectStep) / ROLL_STEPS) & 63;
+            WantedFx.Contrast = FULL_CONTRAST * EffectStep / ROLL_STEPS;
+            if (EffectStep < ROLL_STEPS)
+            {
+                ES_Timer_InitTimer(FX_TIMER, ROLL_STEP_MS);
+            }
+            else
+            {
+                CurrentEffect = FxNone;
+            }
+        }
+        break;
+        
+        default:
+        break;
+    }
+    EffectStep++;
+}
+
+// Ends any effect, the next update puts the panel back to normal
+static void resetEffects(void)
+{
+    ES_Timer_StopTimer(FX_TIMER);
+    CurrentEffect = FxNone;
+    WantedFx = NoFx;
+}
+
+// Called from the SPI interrupt when an update has been sent
+static void updateDone(void)
+{
+    ES_Event_t ThisEvent;
+    ThisEvent.EventType   = ES_UPDATE_COMPLETE;
+    ThisEvent.EventParam  = 1;
+    ES_PostToService(MyPriority, ThisEvent);
 }
 
 // Needs to pass score, time and input by reference 
@@ -997,31 +1179,4 @@ static void bitUnpack(const uint16_t EventParam, uint16_t* score, uint8_t* time,
     *input = EventParam & fourBitMask;
     *time = (EventParam >> 4) & fourBitMask;
     *score = EventParam >> 8;
-}
-
-
-/***************************************************************************
- event checkers
- ***************************************************************************/
-bool Check4WriteDone(void)
-{
-  uint8_t         CurrentDisplayState;
-  bool            ReturnVal = false;
-  
-  if (CurrentState == DisplayBusy){     // only check when display is busy
-  CurrentDisplayState = u8g2_NextPage(&u8g2);
-  
-      // check for display done AND different from last time
-      if ((LastDisplayState != CurrentDisplayState) &&(CurrentDisplayState == 0)) 
-      {
-        // Post event to OLEDService0
-        ES_Event_t ThisEvent;
-        ThisEvent.EventType   = ES_UPDATE_COMPLETE;
-        ThisEvent.EventParam  = 1;
-        ES_PostToService(MyPriority, ThisEvent);
-        ReturnVal = true;
-      }
-      LastDisplayState = CurrentDisplayState; // update the state for next time
-    }
-    return ReturnVal;
 }
\ No newline at end of file
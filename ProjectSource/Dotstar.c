@@ -15,6 +15,10 @@
  When           Who     What/Why
  -------------- ---     --------
  10/30/20 01:46 acg      first pass
+ 11/16/20 15:30 kcao     frames go out through SPIBus instead of a private
+                         SPI1 setup that broke the OLED
+ 11/20/20 11:00 kcao     new colors go into the frame queued last, so the
+                         last write is the one left on the strip
 ****************************************************************************/
 /*----------------------------- Include Files -----------------------------*/
 /* include header files for this state machine as well as any machines at the
@@ -39,11 +43,12 @@
 // My Modules
 #include "Dotstar.h"
 #include "GameState.h"
-#include "spi_master.h"
+#include "SPIBus.h"
 
 
 
 /*----------------------------- Module Defines ----------------------------*/
+#define FRAME_WORDS 5    // start, two LEDs, reset, end
 
 /*---------------------------- Module Functions ---------------------------*/
 /* prototypes for private functions for this machine.They should be functions
@@ -57,6 +62,15 @@ static DotstarState_t CurrentState;
 
 // keep track of values needing to be written on the display
 
+// 32 bit words, clock idle high with data out on the falling edge, 1MHz,
+// no select line, SDO on RB5
+static const SPIBus_Device_t DotstarDevice = {32, 3, 9, SPIBUS_NO_PIN, 
+                                              SPIBUS_NO_PIN, &RPB5R};
+// two frames, so a new color can be queued while the last one is going out
+static uint32_t FrameWords[2][FRAME_WORDS];
+static SPIBus_Transaction_t Frames[2];
+// the frame submitted last, the bus sends it after the other one
+static uint8_t LastFrame;
 
 // with the introduction of Gen2, we need a module level Priority var as well
 static uint8_t MyPriority;
@@ -155,8 +169,6 @@ ES_Event_t RunDotstar(ES_Event_t ThisEvent)
             //initialize SPI for dotstar
             dotStarSPI_Init();
             
-            //enable SPI operation by setting the ON bit
-            SPI1CONbits.ON = 1;
             //transition to next case
             CurrentState = DotstarRed;
             ThisEvent.EventType = ES_RED;
@@ -229,88 +241,42 @@ DotstarState_t QueryDotstar(void)
  private functions
  ***************************************************************************/
 void dotStarSPI_Init(){
-    uint8_t bitWidth = 32;
-    uint16_t bitRate = 10000;
-    uint8_t clearbuff;
-
-    //disable analog function on all SPI pins
-    ANSELAbits.ANSA0 = 0;   //RA0
-    ANSELBbits.ANSB1 = 0;   //RB1
-    ANSELBbits.ANSB15 = 0;  //RB15
-
-    //map SDO, SCK, and SS outputs to desired pins
-    RPA0R = 0b0011; //set RA0 as SS*
-    TRISAbits.TRISA0 = 0; //set RA0 as output
-    
-    RPB5R = 0b0011; //set RB5 as SDO
-    TRISBbits.TRISB5 = 0; //set RB5 as output
-    
-    TRISBbits.TRISB15 = 0; //set RB15 as output, RB15 is always set to SCK
-
-    //stop and reset SPI module by clearing the ON bit
-    SPI1CONbits.ON = 0;
-
-    //clear the receive buffer
-    clearbuff = SPI1BUF;
-
-    //set the ENHBUF bit to use enhanced buffer mode
-    SPI1CONbits.ENHBUF = 1;
-
-    //write the baud rate register
-    SPI1BRG = ((10*10^6) / bitRate) - 1;
-
-    //clear the SPIROV bit
-    SPI1STATbits.SPIROV = 0;
-
-    //write desired settings
-    if (bitWidth == 8){
-        SPI1CONbits.MODE32 = 0; //turn off 32 bit transfer mode
-        SPI1CONbits.MODE16 = 0; //turn off 16 bit transfer mode
-    }
-    else if (bitWidth == 16){
-        SPI1CONbits.MODE32 = 0; //turn off 32 bit transfer mode
-        SPI1CONbits.MODE16 = 1; //turn on 16 bit transfer mode
-    }
-    else if (bitWidth == 32){
-        SPI1CONbits.MODE32 = 1; //turn on 32 bit transfer mode
-        SPI1CONbits.MODE16 = 0; //turn off 16 bit transfer mode
-    }
-
-    SPI1CONbits.CKE = 0; //set 2nd clock edge as active
-    SPI1CONbits.CKP = 1; //set clock idle high
-    SPI1CONbits.MSTEN = 1; //enable master mode
-    SPI1CONbits.MSSEN = 1; //slave select enabled
-    SPI1CONbits.MCLKSEL = 0; //set MCLK as peripheral bus CLK
-    SPI1CONbits.SMP = 0; //input data sampled at middle of data output time
-    SPI1CONbits.FRMPOL = 0; //frame pulse or SS pin is active low
-    SPI1CONbits.FRMEN = 0; //framed SPI support is disabled
-    SPI1CONbits.DISSDI = 0; //SDI pin controlled by SPI module
-
-    //enable SPI operation by setting the ON bit
-    SPI1CONbits.ON = 1;
+    SPIBus_Init();
 }
 
 void dotStar_Write(uint8_t Bright1, uint8_t Red1, uint8_t Blue1, uint8_t Green1, 
             uint8_t Bright2, uint8_t Red2, uint8_t Blue2, uint8_t Green2){
-    uint32_t data;
-    //write start frame
-    SPI_Write(0x00000000);
-    
-    //write first LED to full intensity white
-    data = ((Bright1 << 24) | (Blue1 << 16) | (Green1 << 8) | (Red1));
-    SPI_Write(data);
-    
-    //write second LED to full intensity red
-    data = ((Bright2 << 24) | (Blue2 << 16) | (Green2 << 8) | (Red2));
-    SPI_Write(data);
+    uint8_t which;
+    uint32_t *pWords;
     
-    //write reset frame
-    SPI_Write(0x00000000);
-    
-    //wait for buffer to not be full
-    while (!SPI_HasXmitBufferSpaceOpened()){
+    EnterCritical();    //the bus may start a queued frame under us
+    //the frame queued last goes out last, so while it is still waiting it
+    //can take the new colors. once it is on the bus or out the other one
+    //is free, the bus finishes frames in the order they were queued
+    if (Frames[LastFrame].State == SPIBusQueued){
+        which = LastFrame;
+    }
+    else {
+        which = 1 - LastFrame;
     }
+    pWords = FrameWords[which];
     
-    //write end frame
-    SPI_Write(0xFFFFFFFF);
-}
\ No newline at end of file
+    //start frame
+    pWords[0] = 0x00000000;
+    //first LED
+    pWords[1] = ((Bright1 << 24) | (Blue1 << 16) | (Green1 << 8) | (Red1));
+    //second LED
+    pWords[2] = ((Bright2 << 24) | (Blue2 << 16) | (Green2 << 8) | (Red2));
+    //reset frame
+    pWords[3] = 0x00000000;
+    //end frame
+    pWords[4] = 0xFFFFFFFF;
+    
+    Frames[which].pDevice = &DotstarDevice;
+    Frames[which].pTx = pWords;
+    Frames[which].Count = FRAME_WORDS;
+    Frames[which].Done = NULL;
+    SPIBus_Submit(&Frames[which]);  //no-op if it was already queued
+    LastFrame = which;
+    ExitCritical();
+}
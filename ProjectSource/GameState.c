@@ -10,6 +10,7 @@
  When           Who     What/Why
  -------------- ---     --------
  10/28/20       kcao    File creation 
+ 11/19/20 15:00 kcao    screens are set through the display view
 ****************************************************************************/
 /*----------------------------- Include Files -----------------------------*/
 /* include header files for this state machine as well as any machines at the
@@ -20,6 +21,7 @@
 #include "GameState.h"
 #include "hal.h"
 #include "Seq.h"
+#include "Display.h"
 
 /*----------------------------- Module Defines ----------------------------*/
 
@@ -65,6 +67,7 @@ bool InitGameState(uint8_t Priority)
   MyPriority = Priority;
   CurrentState = InitPState;
   InitEvent.EventType = ES_INIT;
+  InitEvent.EventParam = 0;
   // Set touch sensor (RB4) as a digital input
   TRISBbits.TRISB4 = 1;
 
@@ -122,9 +125,7 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
         for (uint8_t i = 0; i < 4; i++){
           highScores[i] = 0;
         }
-        ES_Event_t DisplayEvent;
-        DisplayEvent.EventType = ES_DISPLAY_WELCOME;
-        //PostDisplay(DisplayEvent);
+        SetDisplayPhase(PhaseWelcome);
         printf("Welcome Screen\r\n");
 
         ES_Event_t DotstarEvent;
@@ -143,10 +144,8 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
         case ES_SENSOR_PRESSED:
         {   
           roundNumber = 1;
-          ES_Event_t DisplayEvent;
-          DisplayEvent.EventType = ES_DISPLAY_READY;
-          DisplayEvent.EventParam = roundNumber;
-          //PostDisplay(DisplayEvent);
+          SetDisplayRound(roundNumber);
+          SetDisplayPhase(PhaseReady);
           printf("Ready Screen\r\n");
 
           ES_Event_t DotstarEvent;
@@ -176,9 +175,7 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
         case ES_TIMEOUT:
         {   
           if (ThisEvent.EventParam == LAST_DIRECTION_TIMER){
-            ES_Event_t DisplayEvent;
-            DisplayEvent.EventType = ES_DISPLAY_GO;
-            //PostDisplay(DisplayEvent);
+            SetDisplayPhase(PhaseGo);
             printf("Go Screen\r\n");
 
             ES_Timer_InitTimer(GO_TIMER, 2000);
@@ -200,9 +197,7 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
       {
         case ES_ROUND_COMPLETE:
         {   
-          ES_Event_t DisplayEvent;
-          DisplayEvent.EventType = ES_DISPLAY_ROUNDCOMPLETE;
-          //PostDisplay(DisplayEvent);
+          SetDisplayPhase(PhaseRoundComplete);
           printf("Round Complete Screen\r\n");
 
           ES_Event_t DotstarEvent;
@@ -215,17 +210,13 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
         case ES_GAME_COMPLETE:
         {   
           uint16_t score = ThisEvent.EventParam;
-          ES_Event_t DisplayEvent;
           ES_Event_t DotstarEvent;
-          DisplayEvent.EventType = ES_DISPLAY_GAMECOMPLETE;
           if (UpdateHighScores(score)){
-            DisplayEvent.EventParam = score;
             DotstarEvent.EventType = ES_GREEN;
           } else {
-            DisplayEvent.EventParam = 0;
             DotstarEvent.EventType = ES_RED;
           }
-          //PostDisplay(DisplayEvent);
+          SetDisplayPhase(PhaseGameComplete);
           //PostDotstar(DotstarEvent);
           ES_Timer_InitTimer(GAMEOVER_TIMER, 30000);
           CurrentState = GameComplete;
@@ -247,10 +238,8 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
         case ES_SENSOR_PRESSED:
         {   
           roundNumber++;
-          ES_Event_t DisplayEvent;
-          DisplayEvent.EventType = ES_DISPLAY_READY;
-          DisplayEvent.EventParam = roundNumber;
-          //PostDisplay(DisplayEvent);
+          SetDisplayRound(roundNumber);
+          SetDisplayPhase(PhaseReady);
           printf("Ready Screen\r\n");
 
           ES_Event_t DotstarEvent;
@@ -274,9 +263,7 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
       {
         case ES_SENSOR_PRESSED:
         {   
-          ES_Event_t DisplayEvent;
-          DisplayEvent.EventType = ES_DISPLAY_WELCOME;
-          //PostDisplay(DisplayEvent);
+          SetDisplayPhase(PhaseWelcome);
           printf("Welcome Screen\r\n");
 
           ES_Event_t DotstarEvent;
@@ -289,9 +276,7 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
         case ES_TIMEOUT:
         {   
           if (ThisEvent.EventParam == GAMEOVER_TIMER){
-            ES_Event_t DisplayEvent;
-            DisplayEvent.EventType = ES_DISPLAY_WELCOME;
-            //PostDisplay(DisplayEvent);
+            SetDisplayPhase(PhaseWelcome);
             printf("Welcome Screen\r\n");
 
             ES_Event_t DotstarEvent;
@@ -314,6 +299,24 @@ ES_Event_t RunGameState(ES_Event_t ThisEvent)
   return ReturnEvent;
 }
 
+/****************************************************************************
+ Function
+     QueryGameState
+ Parameters
+     None
+ Returns
+     GameState_t The current state of the GameState state machine
+ Description
+     returns the current state of the GameState state machine
+ Notes
+ Author
+   K Cao, 11/14/20
+****************************************************************************/
+GameState_t QueryGameState(void)
+{
+  return CurrentState;
+}
+
 // Need to pass by reference (queryHighScores(&score1, &score2, &score3))
 void queryHighScores(uint16_t* score1, uint16_t* score2, uint16_t* score3){
   *score1 = highScores[0];
@@ -333,6 +336,7 @@ bool CheckTouchSensor(){
     if ((currentTouchSensorState != lastTouchSensorState) && (currentTouchSensorState == LOW)){
       ES_Event_t ThisEvent;
       ThisEvent.EventType = ES_SENSOR_PRESSED;
+      ThisEvent.EventParam = 0;
       PostGameState(ThisEvent);
       eventStatus = true;
       printf("Touch Sensor Pressed\r\n");
@@ -0,0 +1,339 @@
+/****************************************************************************
+ Module
+   SPIBus.c
+
+ Revision
+   1.0.0
+
+ Description
+    Owns SPI1 and runs a queue of transactions for the devices sharing it
+    (OLED and Dotstar). Each transaction names its device, and the device
+    carries the word width, SPI mode, clock, select pin, DC pin and the pin
+    SDO1 is routed to. The SPI1 transmit interrupt keeps the enhanced FIFO
+    topped up, and once the last word of a transaction has been shifted out
+    it releases the select line, calls the transaction's Done function and
+    starts the next one.
+
+ Notes
+    Transactions belong to the caller and are linked into the queue, so the
+    queue has no size limit. A transaction and its data must stay put until
+    its State is back to SPIBusFree.
+    Only the device in use has SDO1 mapped to its data pin. The other data
+    pins sit low, which the Dotstar sees as more start frame bits while the
+    clock runs for the OLED.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/16/20 15:30 kcao    first pass, replaces the per-device SPI1 setups
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+// Hardware
+#include <xc.h>
+#include <stddef.h>
+#include <sys/attribs.h> // for ISR macros
+
+// Event & Services Framework
+#include "ES_Types.h"
+
+// My Modules
+#include "SPIBus.h"
+#include "hal.h"
+
+/*----------------------------- Module Defines ----------------------------*/
+#define PPS_SDO1 0b0011     // output function number of SDO1
+
+// SPI1CON STXISEL values
+#define TX_INT_SHIFTED_OUT 0b00 // last word shifted out of SPI1SR
+#define TX_INT_HALF_EMPTY  0b10 // TX FIFO at least half empty
+
+/*---------------------------- Module Functions ---------------------------*/
+static void StartNext(void);
+static void Configure(const SPIBus_Device_t *pDevice);
+static void Fill(void);
+
+/*---------------------------- Module Variables ---------------------------*/
+// queue of transactions, the head is the one on the bus
+static SPIBus_Transaction_t *pHead;
+static SPIBus_Transaction_t *pTail;
+// device SPI1 is set up for right now
+static const SPIBus_Device_t *pCurrentDevice;
+// where the head transaction is up to
+static const uint8_t *pNextWord;
+static uint16_t WordsLeft;
+static bool Initialized = false;
+
+/*------------------------------ Module Code ------------------------------*/
+/****************************************************************************
+ Function
+     SPIBus_Init
+
+ Parameters
+     None
+
+ Returns
+     None
+
+ Description
+     Sets up the SPI1 pins and interrupt. Safe to call from every device's
+     init, only the first call does anything
+ Notes
+     SCK1 is fixed on RB14. SS is driven by hand, so RA0 is a plain output
+ Author
+     K Cao, 11/16/20
+****************************************************************************/
+void SPIBus_Init(void)
+{
+  uint8_t clearbuff;
+
+  if (Initialized)
+  {
+    return;
+  }
+  Initialized = true;
+  pHead = NULL;
+  pTail = NULL;
+  pCurrentDevice = NULL;
+
+  // disable analog function on the bus pins
+  ANSELAbits.ANSA0 = 0;   // RA0, OLED select
+  ANSELAbits.ANSA1 = 0;   // RA1, OLED data
+  ANSELBbits.ANSB14 = 0;  // RB14, SCK1
+
+  // OLED select idles high, data pins idle low until a device is selected
+  RPA0R = 0;
+  LATASET = _LATA_LATA0_MASK;
+  LATACLR = _LATA_LATA1_MASK;
+  LATBCLR = _LATB_LATB5_MASK;
+  TRISACLR = _TRISA_TRISA0_MASK | _TRISA_TRISA1_MASK;
+  TRISBCLR = _TRISB_TRISB5_MASK | _TRISB_TRISB14_MASK;
+
+  SPI1CON = 0;
+  clearbuff = SPI1BUF;
+  SPI1STATbits.SPIROV = 0;
+
+  IPC7bits.SPI1IP = 3;    // below the framework tick
+  IFS1CLR = _IFS1_SPI1TXIF_MASK;
+  IEC1CLR = _IEC1_SPI1TXIE_MASK;
+}
+
+/****************************************************************************
+ Function
+     SPIBus_Submit
+
+ Parameters
+     SPIBus_Transaction_t * : the transaction to queue
+
+ Returns
+     bool, false if the transaction is already queued or on the bus
+
+ Description
+     Adds a transaction to the end of the queue and starts the bus if it
+     was idle. May be called from a Done function
+ Author
+     K Cao, 11/16/20
+****************************************************************************/
+bool SPIBus_Submit(SPIBus_Transaction_t *pTransaction)
+{
+  uint32_t IntState;
+  bool ReturnVal = false;
+
+  IntState = __builtin_get_isr_state();
+  __builtin_disable_interrupts();
+  if (pTransaction->State == SPIBusFree)
+  {
+    pTransaction->State = SPIBusQueued;
+    pTransaction->pNext = NULL;
+    if (pTail != NULL)
+    {
+      pTail->pNext = pTransaction;
+      pTail = pTransaction;
+    }
+    else
+    {
+      // bus was idle
+      pHead = pTransaction;
+      pTail = pTransaction;
+      StartNext();
+    }
+    ReturnVal = true;
+  }
+  __builtin_set_isr_state(IntState);
+  return ReturnVal;
+}
+
+/****************************************************************************
+ Function
+     SPIBus_IsBusy
+
+ Parameters
+     None
+
+ Returns
+     bool, true while any transaction is queued or on the bus
+ Author
+     K Cao, 11/16/20
+****************************************************************************/
+bool SPIBus_IsBusy(void)
+{
+  return pHead != NULL;
+}
+
+/****************************************************************************
+ Function
+     _SPI1_IntHandler
+
+ Parameters
+     None
+
+ Returns
+     None
+
+ Description
+     Tops up the TX FIFO, and when a transaction is completely out finishes
+     it and starts the next one
+ Author
+     K Cao, 11/16/20
+****************************************************************************/
+void __ISR(_SPI_1_VECTOR, IPL3AUTO) _SPI1_IntHandler(void)
+{
+  SPIBus_Transaction_t *pDone;
+  uint32_t clearbuff;
+
+  // clear first, a condition that comes up while we work sets it again
+  IFS1CLR = _IFS1_SPI1TXIF_MASK;
+  // nothing reads the bus, throw away whatever came in
+  while (!SPI1STATbits.SPIRBE)
+  {
+    clearbuff = SPI1BUF;
+  }
+  SPI1STATbits.SPIROV = 0;
+
+  if (WordsLeft != 0)
+  {
+    Fill();
+  }
+  else if (SPI1STATbits.SPITBE && !SPI1STATbits.SPIBUSY)
+  {
+    // last word is out, release the device
+    pDone = pHead;
+    if (pDone->pDevice->CsPin != SPIBUS_NO_PIN)
+    {
+      digitalWrite(pDone->pDevice->CsPin, HIGH);
+    }
+    pHead = pDone->pNext;
+    if (pHead == NULL)
+    {
+      pTail = NULL;
+    }
+    pDone->State = SPIBusFree;
+    if (pDone->Done != NULL)
+    {
+      pDone->Done();
+    }
+    StartNext();
+  }
+}
+
+/***************************************************************************
+ private functions
+ ***************************************************************************/
+// puts the head transaction on the bus, or shuts the interrupt off if the
+// queue is empty. Called with interrupts off or from the ISR
+static void StartNext(void)
+{
+  const SPIBus_Device_t *pDevice;
+
+  if (pHead == NULL)
+  {
+    IEC1CLR = _IEC1_SPI1TXIE_MASK;
+    return;
+  }
+  // a Done function may have submitted and started this one already
+  if (pHead->State == SPIBusActive)
+  {
+    return;
+  }
+  pDevice = pHead->pDevice;
+  Configure(pDevice);
+  if (pDevice->DcPin != SPIBUS_NO_PIN)
+  {
+    digitalWrite(pDevice->DcPin, pHead->Dc);
+  }
+  if (pDevice->CsPin != SPIBUS_NO_PIN)
+  {
+    digitalWrite(pDevice->CsPin, LOW);
+  }
+  pHead->State = SPIBusActive;
+  pNextWord = pHead->pTx;
+  WordsLeft = pHead->Count;
+  IFS1CLR = _IFS1_SPI1TXIF_MASK;
+  Fill();
+  IEC1SET = _IEC1_SPI1TXIE_MASK;
+}
+
+// sets SPI1 up for a device, if it is not already
+static void Configure(const SPIBus_Device_t *pDevice)
+{
+  if (pDevice == pCurrentDevice)
+  {
+    return;
+  }
+  SPI1CONbits.ON = 0;
+  // take SDO1 off the last device's data pin, it falls back to its latch (low)
+  if (pCurrentDevice != NULL)
+  {
+    *pCurrentDevice->SdoPps = 0;
+  }
+  SPI1BRG = pDevice->Brg;
+  SPI1CONbits.MODE32 = (pDevice->Width == 32);
+  SPI1CONbits.MODE16 = (pDevice->Width == 16);
+  SPI1CONbits.CKP = (pDevice->Mode >> 1) & 1;  // clock idle level is CPOL
+  SPI1CONbits.CKE = !(pDevice->Mode & 1);      // CKE is the inverse of CPHA
+  SPI1CONbits.MSTEN = 1;  // master mode
+  SPI1CONbits.MSSEN = 0;  // select lines are driven by hand
+  SPI1CONbits.ENHBUF = 1; // enhanced buffer mode
+  SPI1CONbits.SMP = 0;    // input data sampled at middle of data output time
+  SPI1CONbits.DISSDI = 1; // SDI is not used
+  *pDevice->SdoPps = PPS_SDO1;
+  SPI1CONbits.ON = 1;
+  pCurrentDevice = pDevice;
+}
+
+// writes words of the head transaction until the FIFO is full, then picks
+// the interrupt condition for what is left to do
+static void Fill(void)
+{
+  uint8_t Width = pHead->pDevice->Width;
+
+  while ((WordsLeft != 0) && !SPI1STATbits.SPITBF)
+  {
+    if (Width == 32)
+    {
+      SPI1BUF = *(const uint32_t *)pNextWord;
+      pNextWord += 4;
+    }
+    else if (Width == 16)
+    {
+      SPI1BUF = *(const uint16_t *)pNextWord;
+      pNextWord += 2;
+    }
+    else
+    {
+      SPI1BUF = *pNextWord;
+      pNextWord += 1;
+    }
+    WordsLeft--;
+  }
+  if (WordsLeft != 0)
+  {
+    SPI1CONbits.STXISEL = TX_INT_HALF_EMPTY;
+  }
+  else
+  {
+    SPI1CONbits.STXISEL = TX_INT_SHIFTED_OUT;
+  }
+}
+
+/*------------------------------- Footnotes -------------------------------*/
+/*------------------------------ End of file ------------------------------*/
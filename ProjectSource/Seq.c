@@ -20,6 +20,8 @@
 #include "ES_DeferRecall.h"
 #include "ES_ShortTimer.h"
 #include "ES_Port.h"
+#include "ES_Trace.h"
+#include "TraceIds.h"
 
 // OLED headers
 #include "../u8g2Headers/u8g2TestHarness_main.h"
@@ -30,17 +32,24 @@
 
 // Game Services
 #include "GameState.h"
+#include "Display.h"
 
 /*----------------------------- Module Defines ----------------------------*/
 
 #define ROUND_TIME 15
+// diagnostics go out as trace records when the trace buffer is built in
+// (_INCLUDE_TRACE_ in ES_Configure.h), and are printed as before otherwise
+#ifdef _INCLUDE_TRACE_
+#define SEQ_TRACE(Id, Arg1, Arg2, ...) ES_TRACE((Id), (Arg1), (Arg2))
+#else
+#define SEQ_TRACE(Id, Arg1, Arg2, ...) printf(__VA_ARGS__)
+#endif
 /*---------------------------- Module Functions ---------------------------*/
 /* prototypes for private functions for this machine.They should be functions
    relevant to the behavior of this state machine
 */
 static void updateScore();
 static bool inputChecker(uint32_t *adcResults);
-static uint16_t bitPack(uint16_t score, uint8_t time, uint8_t input);
 
 /*---------------------------- Module Variables ---------------------------*/
 // with the introduction of Gen2, we need a module level Priority variable
@@ -99,6 +108,7 @@ bool InitSequence(uint8_t Priority)
   CurrentState = PseudoInit;
   // post the initial transition event
   InitEvent.EventType = ES_INIT;
+  InitEvent.EventParam = 0;
   if (ES_PostToService(MyPriority, InitEvent) == true)
   {
     return true;
@@ -184,7 +194,7 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                     for (uint8_t i = 0; i < arrayLength; i++){
                         //uint16_t time = rand();
                         seqArray[i] = (rand() %80)/10; //time % 8;
-                        printf("%u\r\n", seqArray[i]);
+                        SEQ_TRACE(TR_SEQ_ENTRY, i, seqArray[i], "%u\r\n", seqArray[i]);
                     }
                     
                     // TESTING
@@ -218,16 +228,15 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                     {
                         // Inform display service to demonstrate input and starts first direction timer
                         displayCounter = 0;
-                        ES_Event_t DisplayEvent;
-                        DisplayEvent.EventType = ES_DISPLAY_INSTRUCTION;
-                        DisplayEvent.EventParam = seqArray[displayCounter];
-                        //PostDisplay(DisplayEvent);
+                        SetDisplayInstruction(seqArray[displayCounter]);
+                        SetDisplayPhase(PhaseInstruction);
                         displayCounter++;
                         ES_Timer_InitTimer(DIRECTION_TIMER, 500);
                         CurrentState = SequenceDisplay;
 
                         // TESTING
-                        printf("Direction %d \r\n", seqArray[seqIndex]); 
+                        SEQ_TRACE(TR_DIRECTION, seqArray[seqIndex], seqIndex, 
+                                  "Direction %d \r\n", seqArray[seqIndex]);
                     }
                 }
                 break;
@@ -248,11 +257,9 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                         case DIRECTION_TIMER:
                         {
                             // Inform display service to demonstrate input and starts subsequent direction timers
-                            ES_Event_t DisplayEvent;
-                            DisplayEvent.EventType = ES_DISPLAY_INSTRUCTION;
-                            DisplayEvent.EventParam = seqArray[displayCounter];
-                            //PostDisplay(DisplayEvent);
-                            printf("Direction %d \r\n", seqArray[displayCounter]);
+                            SetDisplayInstruction(seqArray[displayCounter]);
+                            SEQ_TRACE(TR_DIRECTION, seqArray[displayCounter], displayCounter, 
+                                      "Direction %d \r\n", seqArray[displayCounter]);
                             displayCounter++;
                             
                             
@@ -263,7 +270,8 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
 
                             // If last direction
                             if (displayCounter == (arrayLength - 1)){
-                                printf("Direction %d \r\n", seqArray[displayCounter]);
+                                SEQ_TRACE(TR_DIRECTION, seqArray[displayCounter], displayCounter, 
+                                          "Direction %d \r\n", seqArray[displayCounter]);
                                 ES_Timer_InitTimer(LAST_DIRECTION_TIMER, 500);
                                 displayCounter = 0;
                             }
@@ -277,15 +285,16 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                         {
                             playtimeLeft = ROUND_TIME;
                             // Inform display service to update to play screen and starts input timer
-                            ES_Event_t DisplayEvent;
-                            DisplayEvent.EventType = ES_DISPLAY_PLAY_UPDATE;
-                            DisplayEvent.EventParam = bitPack(score, playtimeLeft, input);
-                            //PostDisplay(DisplayEvent);
+                            SetDisplayScore(score);
+                            SetDisplayTime(playtimeLeft);
+                            SetDisplayInput(input);
+                            SetDisplayPhase(PhasePlay);
                             ES_Timer_InitTimer(INPUT_TIMER, 1000);
                             CurrentState = SequenceInput;
 
                             // TESTING
-                            printf("Gameplay Screen\r\n");
+                            SEQ_TRACE(TR_GAMEPLAY, score, playtimeLeft, 
+                                      "Gameplay Screen\r\n");
                         }
                         break;
                         
@@ -312,12 +321,11 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                         {
                             // Inform display service to update time
                             playtimeLeft--;
-                            ES_Event_t DisplayEvent;
-                            DisplayEvent.EventType = ES_DISPLAY_PLAY_UPDATE;
-                            DisplayEvent.EventParam = bitPack(score, playtimeLeft, input);
+                            SetDisplayTime(playtimeLeft);
                             ES_Timer_InitTimer(INPUT_TIMER, 1000);
 
-                            printf("%u seconds remaining\r\n", playtimeLeft);
+                            SEQ_TRACE(TR_SECONDS_LEFT, playtimeLeft, score, 
+                                      "%u seconds remaining\r\n", playtimeLeft);
                         } 
 
                         else if (playtimeLeft == 0) 
@@ -326,6 +334,7 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                             CurrentState = SequenceCreate;
                             ES_Event_t SequenceEvent;                            
                             SequenceEvent.EventType = ES_FIRST_ROUND;
+                            SequenceEvent.EventParam = 0;
                             PostSequence(SequenceEvent);
 
                             // Inform GameState machine 
@@ -335,11 +344,10 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                             PostGameState(GameStateEvent);
 
                             // Inform display service
-                            ES_Event_t DisplayEvent;
-                            DisplayEvent.EventType = ES_DISPLAY_GAMECOMPLETE;
-                            //PostDisplay(DisplayEvent);
+                            SetDisplayPhase(PhaseGameComplete);
 
-                            printf("Game Over from Timeout\r\n");
+                            SEQ_TRACE(TR_GAME_OVER, 0, score, 
+                                      "Game Over from Timeout\r\n");
                         }
                     }
                     
@@ -352,6 +360,7 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                     CurrentState = SequenceCreate;
                     ES_Event_t SequenceEvent;                            
                     SequenceEvent.EventType = ES_FIRST_ROUND;
+                    SequenceEvent.EventParam = 0;
                     PostSequence(SequenceEvent);
 
                     // Inform GameState machine 
@@ -361,11 +370,10 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                     PostGameState(GameStateEvent);
 
                     // Inform display service
-                    ES_Event_t DisplayEvent;
-                    DisplayEvent.EventType = ES_DISPLAY_GAMECOMPLETE;
-                    //PostDisplay(DisplayEvent);
+                    SetDisplayPhase(PhaseGameComplete);
 
-                    printf("Game Over from Incorrect Input\r\n");
+                    SEQ_TRACE(TR_GAME_OVER, 1, score, 
+                              "Game Over from Incorrect Input\r\n");
                 }
                 break;
 
@@ -374,10 +382,8 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                     updateScore();
                     seqIndex++;
 
-                    ES_Event_t DisplayEvent;
-                    DisplayEvent.EventType = ES_DISPLAY_PLAY_UPDATE;
-                    DisplayEvent.EventParam = bitPack(score, playtimeLeft, input);
-                    //PostDisplay(DisplayEvent);
+                    SetDisplayScore(score);
+                    SetDisplayInput(input);
                     
                     // TESTING
                     //printf("Input Correct\r\n");
@@ -392,17 +398,18 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
                     CurrentState = SequenceCreate;
                     ES_Event_t SequenceEvent;                            
                     SequenceEvent.EventType = ES_NEXT_ROUND;
+                    SequenceEvent.EventParam = 0;
                     PostSequence(SequenceEvent);
 
                     // Inform GameState machine 
                     ES_Event_t GameStateEvent;
                     GameStateEvent.EventType = ES_ROUND_COMPLETE;
+                    GameStateEvent.EventParam = 0;
                     PostGameState(GameStateEvent);
 
                     // Inform display service
-                    ES_Event_t DisplayEvent;
-                    DisplayEvent.EventType = ES_DISPLAY_ROUNDCOMPLETE;
-                    //PostDisplay(DisplayEvent);
+                    SetDisplayScore(score);
+                    SetDisplayPhase(PhaseRoundComplete);
 
                     // TESTING
                     //printf("Round Complete\r\n");
@@ -420,6 +427,21 @@ ES_Event_t RunSequence(ES_Event_t ThisEvent)
   return ReturnEvent;
 }
 
+/****************************************************************************
+ Function
+   QuerySequence
+ Parameters
+   None
+ Returns
+   SequenceState_t The current state of the Sequence state machine
+ Description
+     returns the current state of the Sequence state machine
+****************************************************************************/
+SequenceState_t QuerySequence(void)
+{
+  return CurrentState;
+}
+
 /* Event Checkers ------------------------------------------------------------
  * This event checker takes reads the joystick x and y values when
  * the z button is pressed, preserving the input the user wants to give to
@@ -454,8 +476,8 @@ bool xyVal (void)
         }
         else if (lastZVal == 1 && currentZVal == 0)
         {
-            printf("ADC %d     ", adcResults[0]);
-            printf("ADC %d     \r\n", adcResults[1]);
+            SEQ_TRACE(TR_JOYSTICK_ADC, adcResults[0], adcResults[1], 
+                      "ADC %d     ADC %d     \r\n", adcResults[0], adcResults[1]);
             
             // Check if this is the last input to post correct event
             if (seqIndex < (arrayLength - 1))          // Not last input
@@ -465,6 +487,7 @@ bool xyVal (void)
                 {
                     // Post Correct Event
                     JoystickEvent.EventType = ES_CORRECT_INPUT;
+                    JoystickEvent.EventParam = 0;
                     PostSequence(JoystickEvent);
                     //printf("posted Correct Input\r\n");
                 }
@@ -472,6 +495,7 @@ bool xyVal (void)
                 {
                     // Post Incorrect Event
                     JoystickEvent.EventType = ES_INCORRECT_INPUT;
+                    JoystickEvent.EventParam = 0;
                     PostSequence(JoystickEvent);
                     //printf("posted Incorrect Input\r\n");
                 }
@@ -483,6 +507,7 @@ bool xyVal (void)
                 {
                     //Post Correct Final Event
                     JoystickEvent.EventType = ES_CORRECT_INPUT_FINAL;
+                    JoystickEvent.EventParam = 0;
                     PostSequence(JoystickEvent);
                     //printf("posted Correct Input F\r\n");
                 }
@@ -490,6 +515,7 @@ bool xyVal (void)
                 {
                     //Post Incorrect Event
                     JoystickEvent.EventType = ES_INCORRECT_INPUT;
+                    JoystickEvent.EventParam = 0;
                     PostSequence(JoystickEvent);
                     //printf("posted Incorrect Input\r\n");
                 }
@@ -656,11 +682,3 @@ static void updateScore(){
         score = score + (arrayLength / 4) * 10;
     }
 }
-
-// score 9 bits, time 4 bits, input 3 bits 
-static uint16_t bitPack(uint16_t score, uint8_t time, uint8_t input){
-    uint16_t EventParam = score << 7;
-    EventParam = EventParam | (time << 3);
-    EventParam = EventParam | (input);
-    return EventParam;
-}
\ No newline at end of file
@@ -46,6 +46,7 @@
 #include "ES_DeferRecall.h"
 #include "ES_ShortTimer.h"
 #include "ES_Port.h"
+#include "ES_EventRecorder.h"
 
 // My Modules
 #include "Seq.h"
@@ -315,6 +316,14 @@ ES_Event_t RunTestHarnessService0(ES_Event_t ThisEvent)
           ThisEvent.EventParam = 9800;
           PostDisplay(ThisEvent);
       }
+
+#ifdef _INCLUDE_EVENT_RECORDER_
+      if ('D' == ThisEvent.EventParam)
+      {
+          // dump the event trace for Tools/EventReplay
+          ES_Recorder_Dump();
+      }
+#endif
       
       
         
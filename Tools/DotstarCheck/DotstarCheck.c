@@ -0,0 +1,233 @@
+/****************************************************************************
+ Module
+   DotstarCheck.c
+
+ Revision
+   1.0.0
+
+ Description
+   Host check for dotStar_Write. The real Dotstar.c is built against a
+   stand-in for SPIBus which queues transactions the same way, but only
+   moves them along when told to, so writes can be made while the bus is
+   busy with the OLED or with an earlier frame. Each frame that finishes
+   sets the strip to its colors. The checks:
+     - however many writes are made while the bus is busy, the last one is
+       the color left on the strip
+     - colors reach the strip in the order they were written, an older
+       color never follows a newer one
+     - a frame is never changed while it is on the bus
+
+ Notes
+   Build and run from this directory:
+
+     cc -std=gnu99 -O2 -I../EventReplay/shim -I../../FrameworkHeaders \
+        -I../../ProjectHeaders DotstarCheck.c ../../ProjectSource/Dotstar.c \
+        -o DotstarCheck
+     ./DotstarCheck
+
+   It prints one line per check and exits with 1 if any of them fails.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/20/20 11:00 kcao    started coding
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "Dotstar.h"
+#include "SPIBus.h"
+
+/*----------------------------- Module Defines ----------------------------*/
+#define MAX_QUEUED 8
+#define RANDOM_STEPS 100000
+#define FRAME_LED1 1          // word of the first LED in a Dotstar frame
+
+/*---------------------------- Module Functions ---------------------------*/
+static void Write(uint16_t Color);
+static bool Step(void);
+static void Drain(void);
+static bool Report(const char *pCheck, bool Passed);
+
+/*---------------------------- Module Variables ---------------------------*/
+// the PPS register Dotstar.c routes SDO1 with
+volatile uint32_t RPB5R;
+
+// queue of the stand-in bus, Queue[0] is the head
+static SPIBus_Transaction_t *Queue[MAX_QUEUED];
+static uint8_t QueueLen;
+// what the head frame held when it went on the bus
+static uint32_t ActiveLed1;
+
+// an OLED transfer to keep the bus busy, only its State matters
+static const SPIBus_Device_t OledDevice = {8, 0, 0, SPIBUS_NO_PIN,
+                                           SPIBUS_NO_PIN, &RPB5R};
+static SPIBus_Transaction_t OledTransfer;
+
+// strip state: the color last written and the one it shows
+static uint16_t Written;
+static int32_t Shown;
+static bool InOrder;
+static bool Unchanged;
+
+/*------------------------------ Module Code ------------------------------*/
+// stand-ins for the framework, Dotstar.c only posts from its own service
+bool ES_PostToService(uint8_t WhichService, ES_Event_t TheEvent)
+{
+  return true;
+}
+
+void SPIBus_Init(void)
+{
+}
+
+// same rules as the real one: only a free transaction is queued, at the end
+bool SPIBus_Submit(SPIBus_Transaction_t *pTransaction)
+{
+  if ((pTransaction->State != SPIBusFree) || (QueueLen == MAX_QUEUED))
+  {
+    return false;
+  }
+  pTransaction->State = SPIBusQueued;
+  Queue[QueueLen++] = pTransaction;
+  return true;
+}
+
+bool SPIBus_IsBusy(void)
+{
+  return QueueLen != 0;
+}
+
+// writes a color to both LEDs, red is the low byte and green the high one
+static void Write(uint16_t Color)
+{
+  Written = Color;
+  dotStar_Write(0xFF, Color & 0xFF, 0x00, Color >> 8,
+                0xFF, Color & 0xFF, 0x00, Color >> 8);
+}
+
+// moves the bus one step on: puts the head on the bus, or finishes it and
+// lets a Dotstar frame set the strip. Returns false if the queue is empty
+static bool Step(void)
+{
+  SPIBus_Transaction_t *pHead;
+  uint32_t Led1;
+  uint8_t i;
+
+  if (QueueLen == 0)
+  {
+    return false;
+  }
+  pHead = Queue[0];
+  if (pHead->State == SPIBusQueued)
+  {
+    pHead->State = SPIBusActive;
+    if (pHead != &OledTransfer)
+    {
+      ActiveLed1 = ((const uint32_t *)pHead->pTx)[FRAME_LED1];
+    }
+    return true;
+  }
+  if (pHead != &OledTransfer)
+  {
+    Led1 = ((const uint32_t *)pHead->pTx)[FRAME_LED1];
+    if (Led1 != ActiveLed1)
+    {
+      Unchanged = false;
+    }
+    // red in the low byte, green in bits 8 to 15
+    if ((int32_t)(Led1 & 0xFFFF) < Shown)
+    {
+      InOrder = false;
+    }
+    Shown = Led1 & 0xFFFF;
+  }
+  pHead->State = SPIBusFree;
+  for (i = 1; i < QueueLen; i++)
+  {
+    Queue[i - 1] = Queue[i];
+  }
+  QueueLen--;
+  return true;
+}
+
+// runs the bus until everything queued is out
+static void Drain(void)
+{
+  while (Step())
+  {
+  }
+}
+
+static bool Report(const char *pCheck, bool Passed)
+{
+  printf("%-52s %s\n", pCheck, Passed ? "ok" : "FAILED");
+  return Passed;
+}
+
+int main(void)
+{
+  char Check[64];
+  bool Passed = true;
+  uint16_t Color = 0;
+  uint8_t Writes;
+  uint8_t i;
+  uint32_t n;
+
+  OledTransfer.pDevice = &OledDevice;
+  dotStarSPI_Init();
+  Shown = -1;
+  InOrder = true;
+  Unchanged = true;
+
+  // writes while the OLED holds the bus
+  for (Writes = 1; Writes <= 4; Writes++)
+  {
+    SPIBus_Submit(&OledTransfer);
+    Step();
+    for (i = 0; i < Writes; i++)
+    {
+      Write(++Color);
+    }
+    Drain();
+    sprintf(Check, "%u writes while the OLED is on the bus", Writes);
+    Passed &= Report(Check, Shown == Written);
+  }
+
+  // writes while a frame of our own is on the bus, and one waits behind it
+  Write(++Color);
+  Step();
+  Write(++Color);
+  Write(++Color);
+  Write(++Color);
+  Drain();
+  Passed &= Report("3 writes while a frame is on the bus", Shown == Written);
+
+  // writes and bus steps in random order, OLED transfers in between
+  srand(1);
+  for (n = 0; n < RANDOM_STEPS; n++)
+  {
+    switch (rand() % 4)
+    {
+      case 0:
+        SPIBus_Submit(&OledTransfer);
+        break;
+      case 1:
+        Write(++Color);
+        break;
+      default:
+        Step();
+        break;
+    }
+  }
+  Drain();
+  Passed &= Report("random writes and transfers", Shown == Written);
+  Passed &= Report("colors reach the strip in order", InOrder);
+  Passed &= Report("no frame changes while it is on the bus", Unchanged);
+  return Passed ? 0 : 1;
+}
+/*------------------------------ End of file ------------------------------*/
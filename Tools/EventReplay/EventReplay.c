@@ -0,0 +1,549 @@
+/****************************************************************************
+ Module
+   EventReplay.c
+
+ Revision
+   1.0.0
+
+ Description
+   Host tool that re-runs an event trace captured by ES_EventRecorder through
+   the real GameState and Seq services under virtual time, and checks that
+   every post and every dispatch (including the state each service ends up
+   in) happens in the same order, at the same tick, as on the target.
+
+ Notes
+   Build from this directory with any C99 compiler:
+
+     cc -std=gnu99 -D_INCLUDE_EVENT_RECORDER_ -Ishim \
+        -I../../FrameworkHeaders -I../../ProjectHeaders \
+        EventReplay.c \
+        ../../FrameworkSource/ES_Framework.c \
+        ../../FrameworkSource/ES_EventRecorder.c \
+        ../../FrameworkSource/ES_Queue.c \
+        ../../FrameworkSource/ES_Timers.c \
+        ../../FrameworkSource/ES_LookupTables.c \
+        ../../FrameworkSource/ES_CheckEvents.c \
+        ../../FrameworkSource/ES_DeferRecall.c \
+        ../../FrameworkSource/ES_PostList.c \
+        ../../ProjectSource/GameState.c \
+        ../../ProjectSource/Seq.c \
+        -o EventReplay
+
+   and run it on the raw terminal capture of a 'D' keypress:
+
+     ./EventReplay [-v] capture.bin
+
+   The unmodified ES_Run loop drives the replay. The services that talk to
+   hardware (TestHarnessService0, Display, Dotstar) are scripted: when they
+   run, they re-post whatever the trace says they posted. Events that came
+   from event checkers are injected by Check4Keystroke at their recorded
+   tick. Everything else (ES_INIT, timer expiries, GameState <-> Seq posts)
+   must be regenerated by the live services for the replay to pass.
+
+   rand() on the host is not the xc32 rand(), so the direction sequence
+   Seq builds differs from the target. None of the posts depend on it.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/14/20 10:05 kcao    started coding
+ 11/19/20 15:00 kcao    stubs for the display view setters
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ES_Configure.h"
+#include "ES_Framework.h"
+#include "ES_EventRecorder.h"
+#include "ES_ServiceHeaders.h"
+#include "EventCheckWrapper.h"
+#include "hal.h"
+#include "PIC32_AD_Lib.h"
+
+#ifndef _INCLUDE_EVENT_RECORDER_
+#error "build EventReplay with -D_INCLUDE_EVENT_RECORDER_"
+#endif
+
+/*----------------------------- Module Defines ----------------------------*/
+#define RECORD_BYTES 8
+#define HEADER_BYTES 12
+// give up if this many ticks pass without the trace moving forward
+#define STALL_TICKS 0x10000UL
+
+/*---------------------------- Module Functions ---------------------------*/
+static bool LoadTrace(const char *FileName);
+static bool IsInjected(const ES_EventRecord_t *pRecord);
+static void PostRecord(const ES_EventRecord_t *pRecord);
+static void PlayScriptedPosts(uint8_t WhichService);
+static void CheckProgress(void);
+static void PrintRecord(const char *Label, const ES_EventRecord_t *pRecord);
+static void Finish(bool Passed);
+
+/*---------------------------- Module Variables ---------------------------*/
+// stand-ins for the SFRs declared in shim/xc.h
+TRISAbits_t TRISAbits;
+TRISBbits_t TRISBbits;
+ANSELBbits_t ANSELBbits;
+PORTAbits_t PORTAbits;
+PORTBbits_t PORTBbits;
+U1STAbits_t U1STAbits;
+uint8_t _INTCON_temp;
+
+static const char *const ServiceName[] = {
+  SERV_0_HEADER
+#if NUM_SERVICES > 1
+  , SERV_1_HEADER
+#endif
+#if NUM_SERVICES > 2
+  , SERV_2_HEADER
+#endif
+#if NUM_SERVICES > 3
+  , SERV_3_HEADER
+#endif
+#if NUM_SERVICES > 4
+  , SERV_4_HEADER
+#endif
+#if NUM_SERVICES > 5
+  , SERV_5_HEADER
+#endif
+#if NUM_SERVICES > 6
+  , SERV_6_HEADER
+#endif
+#if NUM_SERVICES > 7
+  , SERV_7_HEADER
+#endif
+};
+
+static ES_EventRecord_t *Trace;
+static uint32_t TraceCount;
+static uint32_t Checked;          // records already compared
+static bool Verbose;
+
+static uint16_t VirtualTime;
+static uint8_t PendingTicks;
+static uint32_t IdleTicks;
+
+static bool IsScripted[MAX_NUM_SERVICES];
+static uint8_t ScriptedState[MAX_NUM_SERVICES];
+static uint8_t DisplayPriority;
+static uint8_t DotstarPriority;
+static uint8_t HarnessPriority;
+
+/*------------------------------ Module Code ------------------------------*/
+int main(int argc, char *argv[])
+{
+  const char *FileName = NULL;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (strcmp(argv[i], "-v") == 0)
+    {
+      Verbose = true;
+    }
+    else
+    {
+      FileName = argv[i];
+    }
+  }
+  if (FileName == NULL)
+  {
+    fprintf(stderr, "usage: %s [-v] trace\n", argv[0]);
+    return 2;
+  }
+  if (!LoadTrace(FileName))
+  {
+    return 2;
+  }
+  // the services print as they go, keep that out of the report
+  if (!Verbose)
+  {
+    freopen("/dev/null", "w", stdout);
+  }
+  if (ES_Initialize(ES_Timer_RATE_1mS) != Success)
+  {
+    fprintf(stderr, "ES_Initialize failed\n");
+    return 1;
+  }
+  ES_Run();   // only returns on FailedRun, Finish() exits otherwise
+  fprintf(stderr, "ES_Run failed\n");
+  return 1;
+}
+
+/***************************************************************************
+ host port of the hardware specific framework functions
+ ***************************************************************************/
+void _HW_Timer_Init(const TimerRate_t Rate)
+{
+  VirtualTime = 0;
+  PendingTicks = 0;
+}
+
+uint16_t _HW_GetTickCount(void)
+{
+  return VirtualTime;
+}
+
+bool _HW_Process_Pending_Ints(void)
+{
+  while (PendingTicks > 0)
+  {
+    ES_Timer_Tick_Resp();
+    PendingTicks--;
+  }
+  return true;
+}
+
+void Terminal_WriteByte(uint8_t txByte)
+{
+  (void)txByte;
+}
+
+uint8_t digitalRead(uint8_t pin)
+{
+  return HIGH;  // touch sensor released, presses come from the trace
+}
+
+bool ADC_ConfigAutoScan(uint16_t whichPins, uint8_t numPins)
+{
+  return true;
+}
+
+void ADC_MultiRead(uint32_t *adcResults)
+{
+  adcResults[0] = 512;
+  adcResults[1] = 512;
+}
+
+/***************************************************************************
+ event checkers, Check4Keystroke is the replay driver
+ ***************************************************************************/
+bool Check4Keystroke(void)
+{
+  ES_EventRecord_t *pNext;
+
+  CheckProgress();
+  pNext = &Trace[Checked];
+  if (IsInjected(pNext) && (pNext->Tick == VirtualTime))
+  {
+    PostRecord(pNext);
+    return true;
+  }
+  // nothing due now, let a tick go by
+  VirtualTime++;
+  PendingTicks++;
+  if (++IdleTicks > STALL_TICKS)
+  {
+    fprintf(stderr, "stalled at tick %u waiting for record %lu\n",
+        VirtualTime, (unsigned long)Checked);
+    PrintRecord("expected", pNext);
+    Finish(false);
+  }
+  // an event checker can see the new tick before the pending ints run
+  if (IsInjected(pNext) && (pNext->Tick == VirtualTime))
+  {
+    PostRecord(pNext);
+    return true;
+  }
+  return false;
+}
+
+/***************************************************************************
+ scripted services
+ ***************************************************************************/
+bool InitTestHarnessService0(uint8_t Priority)
+{
+  HarnessPriority = Priority;
+  IsScripted[Priority] = true;
+  PlayScriptedPosts(Priority);
+  return true;
+}
+
+bool PostTestHarnessService0(ES_Event_t ThisEvent)
+{
+  return ES_PostToService(HarnessPriority, ThisEvent);
+}
+
+ES_Event_t RunTestHarnessService0(ES_Event_t ThisEvent)
+{
+  PlayScriptedPosts(HarnessPriority);
+  ThisEvent.EventType = ES_NO_EVENT;
+  return ThisEvent;
+}
+
+bool InitDisplay(uint8_t Priority)
+{
+  DisplayPriority = Priority;
+  IsScripted[Priority] = true;
+  PlayScriptedPosts(Priority);
+  return true;
+}
+
+bool PostDisplay(ES_Event_t ThisEvent)
+{
+  return ES_PostToService(DisplayPriority, ThisEvent);
+}
+
+ES_Event_t RunDisplay(ES_Event_t ThisEvent)
+{
+  PlayScriptedPosts(DisplayPriority);
+  ThisEvent.EventType = ES_NO_EVENT;
+  return ThisEvent;
+}
+
+DisplayState_t QueryDisplay(void)
+{
+  return (DisplayState_t)ScriptedState[DisplayPriority];
+}
+
+// the view setters only store values on the target, the frames they lead
+// to are the Display posts in the trace
+void SetDisplayPhase(DisplayPhase_t Phase) {}
+void SetDisplayScore(uint16_t score) {}
+void SetDisplayRound(uint16_t round) {}
+void SetDisplayTime(uint8_t time) {}
+void SetDisplayInput(uint8_t input) {}
+void SetDisplayInstruction(uint16_t instruction) {}
+
+bool InitDotstar(uint8_t Priority)
+{
+  DotstarPriority = Priority;
+  IsScripted[Priority] = true;
+  PlayScriptedPosts(Priority);
+  return true;
+}
+
+bool PostDotstar(ES_Event_t ThisEvent)
+{
+  return ES_PostToService(DotstarPriority, ThisEvent);
+}
+
+ES_Event_t RunDotstar(ES_Event_t ThisEvent)
+{
+  PlayScriptedPosts(DotstarPriority);
+  ThisEvent.EventType = ES_NO_EVENT;
+  return ThisEvent;
+}
+
+DotstarState_t QueryDotstar(void)
+{
+  return (DotstarState_t)ScriptedState[DotstarPriority];
+}
+
+/***************************************************************************
+ private functions
+ ***************************************************************************/
+static bool LoadTrace(const char *FileName)
+{
+  FILE *pFile;
+  uint8_t *pBytes;
+  long Length;
+  long Start;
+  uint32_t Total;
+  uint16_t Capacity;
+  uint16_t Sum = 0;
+  uint16_t FileSum;
+  uint32_t i;
+
+  pFile = fopen(FileName, "rb");
+  if (pFile == NULL)
+  {
+    perror(FileName);
+    return false;
+  }
+  fseek(pFile, 0, SEEK_END);
+  Length = ftell(pFile);
+  rewind(pFile);
+  pBytes = malloc(Length + 1);
+  if ((pBytes == NULL) || (fread(pBytes, 1, Length, pFile) != (size_t)Length))
+  {
+    fprintf(stderr, "%s: read failed\n", FileName);
+    return false;
+  }
+  fclose(pFile);
+
+  // the capture usually has terminal chatter around the dump
+  for (Start = 0; Start + HEADER_BYTES <= Length; Start++)
+  {
+    if ((pBytes[Start] == 'E') && (pBytes[Start + 1] == 'S') &&
+        (pBytes[Start + 2] == 'R') && (pBytes[Start + 3] == ES_REC_VERSION))
+    {
+      break;
+    }
+  }
+  if (Start + HEADER_BYTES > Length)
+  {
+    fprintf(stderr, "%s: no ESR%d header found\n", FileName, ES_REC_VERSION);
+    return false;
+  }
+  if ((pBytes[Start + 4] | (pBytes[Start + 5] << 8)) != RECORD_BYTES)
+  {
+    fprintf(stderr, "%s: unexpected record size\n", FileName);
+    return false;
+  }
+  Capacity = pBytes[Start + 6] | (pBytes[Start + 7] << 8);
+  Total = pBytes[Start + 8] | (pBytes[Start + 9] << 8) |
+      ((uint32_t)pBytes[Start + 10] << 16) |
+      ((uint32_t)pBytes[Start + 11] << 24);
+  if (Total > Capacity)
+  {
+    fprintf(stderr, "%s: ring wrapped (%lu records made, %u kept); the "
+        "replay needs the trace from ES_Initialize on, raise "
+        "EVENT_RECORDER_SIZE\n", FileName, (unsigned long)Total, Capacity);
+    return false;
+  }
+  if (Start + HEADER_BYTES + (long)Total * RECORD_BYTES + 2 > Length)
+  {
+    fprintf(stderr, "%s: trace is truncated\n", FileName);
+    return false;
+  }
+
+  Trace = calloc(Total + 1, sizeof(ES_EventRecord_t));
+  pBytes += Start + HEADER_BYTES;
+  for (i = 0; i < Total * RECORD_BYTES; i++)
+  {
+    Sum += pBytes[i];
+  }
+  FileSum = pBytes[i] | (pBytes[i + 1] << 8);
+  if (Sum != FileSum)
+  {
+    fprintf(stderr, "%s: checksum mismatch\n", FileName);
+    return false;
+  }
+  for (i = 0; i < Total; i++, pBytes += RECORD_BYTES)
+  {
+    Trace[i].Tick = pBytes[0] | (pBytes[1] << 8);
+    Trace[i].EventParam = pBytes[2] | (pBytes[3] << 8);
+    Trace[i].EventType = pBytes[4];
+    Trace[i].Service = pBytes[5];
+    Trace[i].Source = pBytes[6];
+    Trace[i].Flags = pBytes[7];
+  }
+  // sentinel that is never injected, so the driver has something to look at
+  Trace[Total].Flags = ES_REC_DISPATCH;
+  TraceCount = Total;
+  fprintf(stderr, "loaded %lu records\n", (unsigned long)TraceCount);
+  return true;
+}
+
+// true for posts the live services can not regenerate on their own
+static bool IsInjected(const ES_EventRecord_t *pRecord)
+{
+  if (pRecord->Flags & ES_REC_DISPATCH)
+  {
+    return false;
+  }
+  if (pRecord->Source == ES_REC_SOURCE_CHECKER)
+  {
+    return true;
+  }
+  // timers started by a scripted service
+  return (pRecord->Source == ES_REC_SOURCE_INTS) &&
+         (pRecord->Service < MAX_NUM_SERVICES) &&
+         IsScripted[pRecord->Service];
+}
+
+static void PostRecord(const ES_EventRecord_t *pRecord)
+{
+  ES_Event_t ThisEvent;
+
+  ThisEvent.EventType = (ES_EventType_t)pRecord->EventType;
+  ThisEvent.EventParam = pRecord->EventParam;
+  IdleTicks = 0;
+  if (pRecord->Service == ES_REC_ALL_SERVICES)
+  {
+    ES_PostAll(ThisEvent);
+  }
+  else if (pRecord->Flags & ES_REC_POST_LIFO)
+  {
+    ES_PostToServiceLIFO(pRecord->Service, ThisEvent);
+  }
+  else
+  {
+    ES_PostToService(pRecord->Service, ThisEvent);
+  }
+}
+
+// re-posts what a scripted service posted at this point of the trace
+static void PlayScriptedPosts(uint8_t WhichService)
+{
+  uint32_t Next = ES_Recorder_GetTotal();
+
+  while ((Next < TraceCount) && !(Trace[Next].Flags & ES_REC_DISPATCH) &&
+      (Trace[Next].Source == WhichService))
+  {
+    PostRecord(&Trace[Next]);
+    Next = ES_Recorder_GetTotal();
+  }
+  // the state it reports afterwards comes from the dispatch record
+  if ((Next < TraceCount) && (Trace[Next].Flags & ES_REC_DISPATCH) &&
+      (Trace[Next].Service == WhichService))
+  {
+    ScriptedState[WhichService] = Trace[Next].Source;
+  }
+}
+
+// compares everything recorded since the last call against the trace
+static void CheckProgress(void)
+{
+  ES_EventRecord_t Replayed;
+  uint32_t Total = ES_Recorder_GetTotal();
+
+  while ((Checked < Total) && (Checked < TraceCount))
+  {
+    ES_Recorder_GetRecord((uint16_t)Checked, &Replayed);
+    if (memcmp(&Replayed, &Trace[Checked], sizeof(Replayed)) != 0)
+    {
+      fprintf(stderr, "mismatch at record %lu\n", (unsigned long)Checked);
+      PrintRecord("expected", &Trace[Checked]);
+      PrintRecord("replayed", &Replayed);
+      Finish(false);
+    }
+    if (Verbose)
+    {
+      PrintRecord("ok", &Replayed);
+    }
+    Checked++;
+    IdleTicks = 0;
+  }
+  if (Checked == TraceCount)
+  {
+    Finish(true);
+  }
+}
+
+static void PrintRecord(const char *Label, const ES_EventRecord_t *pRecord)
+{
+  const char *Name = "all";
+
+  if (pRecord->Service < ARRAY_SIZE(ServiceName))
+  {
+    Name = ServiceName[pRecord->Service];
+  }
+  if (pRecord->Flags & ES_REC_DISPATCH)
+  {
+    fprintf(stderr, "  %-8s t=%5u run  %-16s event %3u param %5u -> state %u\n",
+        Label, pRecord->Tick, Name, pRecord->EventType, pRecord->EventParam,
+        pRecord->Source);
+  }
+  else
+  {
+    fprintf(stderr, "  %-8s t=%5u post %-16s event %3u param %5u from %u%s%s\n",
+        Label, pRecord->Tick, Name, pRecord->EventType, pRecord->EventParam,
+        pRecord->Source, (pRecord->Flags & ES_REC_POST_LIFO) ? " LIFO" : "",
+        (pRecord->Flags & ES_REC_FAILED) ? " FAILED" : "");
+  }
+}
+
+static void Finish(bool Passed)
+{
+  if (Passed)
+  {
+    fprintf(stderr, "replay matches: %lu records, last tick %u\n",
+        (unsigned long)TraceCount, VirtualTime);
+    exit(0);
+  }
+  exit(1);
+}
@@ -0,0 +1,18 @@
+/****************************************************************************
+ Module
+     PIC32_AD_Lib.h (host shim)
+ Description
+     ADC prototypes for the host build of the game services. The replay
+     never reads the joystick (its input events come from the trace), so the
+     host versions in EventReplay.c only return mid-scale readings.
+*****************************************************************************/
+#ifndef HOST_PIC32_AD_LIB_H
+#define HOST_PIC32_AD_LIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+bool ADC_ConfigAutoScan(uint16_t whichPins, uint8_t numPins);
+void ADC_MultiRead(uint32_t *adcResults);
+
+#endif /* HOST_PIC32_AD_LIB_H */
@@ -0,0 +1,2 @@
+/* host shim for <p32xxxx.h>, everything needed lives in xc.h */
+#include "xc.h"
@@ -0,0 +1,2 @@
+/* host shim for <proc/p32mx170f256b.h>, everything needed lives in xc.h */
+#include "../xc.h"
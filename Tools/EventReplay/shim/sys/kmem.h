@@ -0,0 +1,2 @@
+/* host shim for <sys/kmem.h>, everything needed lives in xc.h */
+#include "../xc.h"
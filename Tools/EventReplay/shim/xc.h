@@ -0,0 +1,40 @@
+/****************************************************************************
+ Module
+     xc.h (host shim)
+ Description
+     Stands in for the xc32 device header when the game services are built
+     on the host by Tools/EventReplay and Tools/DotstarCheck. Only the SFR
+     bits the services touch are provided; they are plain variables defined
+     in the tool that uses them.
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/14/20 10:05 kcao    started coding
+ 11/20/20 11:00 kcao    RPB5R for Dotstar.c
+*****************************************************************************/
+#ifndef HOST_XC_H
+#define HOST_XC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define __builtin_disable_interrupts() ((void)0)
+#define __builtin_enable_interrupts()  ((void)0)
+
+typedef struct { unsigned TRISA0:1, TRISA1:1, TRISA2:1, TRISA3:1, TRISA4:1; } TRISAbits_t;
+typedef struct { unsigned TRISB0:1, TRISB1:1, TRISB2:1, TRISB3:1, TRISB4:1,
+                 TRISB5:1, TRISB12:1, TRISB13:1, TRISB14:1, TRISB15:1; } TRISBbits_t;
+typedef struct { unsigned ANSB2:1, ANSB3:1, ANSB12:1, ANSB13:1, ANSB14:1, ANSB15:1; } ANSELBbits_t;
+typedef struct { unsigned RA2:1; } PORTAbits_t;
+typedef struct { unsigned RB2:1, RB3:1, RB4:1; } PORTBbits_t;
+typedef struct { unsigned URXDA:1, UTXBF:1, OERR:1; } U1STAbits_t;
+
+extern TRISAbits_t TRISAbits;
+extern TRISBbits_t TRISBbits;
+extern ANSELBbits_t ANSELBbits;
+extern PORTAbits_t PORTAbits;
+extern PORTBbits_t PORTBbits;
+extern U1STAbits_t U1STAbits;
+extern volatile uint32_t RPB5R;
+
+#endif /* HOST_XC_H */
@@ -0,0 +1,225 @@
+/****************************************************************************
+ Module
+   FontBench.c
+
+ Revision
+   1.0.0
+
+ Description
+   Host benchmark for the u8g2 text path. Draws every string Display.c puts
+   on the screen, at the same position and in the same draw mode, into a
+   full SSD1306 buffer and reports the average time per u8g2_DrawStr call
+   and a checksum of the pixels it produced. u8g2_GetStrWidth is timed as
+   well, it only looks glyphs up.
+
+ Notes
+   Build from this directory twice, with and without the glyph cache, font
+   index and direct glyph decoder:
+
+     U8G2="u8g2_buffer.c u8g2_ll_hvline.c u8g2_setup.c u8g2_d_setup.c \
+           u8g2_d_memory.c u8g2_font.c u8g2_fonts.c u8g2_hvline.c \
+           u8g2_bitmap.c \
+           u8g2_box.c u8g2_circle.c u8g2_intersection.c u8g2_kerning.c \
+           u8g2_span.c \
+           u8x8_8x8.c u8x8_setup.c u8x8_display.c u8x8_cad.c u8x8_byte.c \
+           u8x8_gpio.c u8x8_u16toa.c u8x8_d_ssd1306_128x64_noname.c"
+     cc -std=gnu99 -O2 -DU8X8_WITHOUT_FIXED_SSD1306_SPI \
+        -DU8G2_WITH_GLYPH_CACHE -DU8G2_WITH_FONT_INDEX \
+        -I../../u8g2Headers FontBench.c \
+        $(for f in $U8G2; do echo ../../u8g2/$f; done) -o FontBench
+     cc -std=gnu99 -O2 -DU8X8_WITHOUT_FIXED_SSD1306_SPI \
+        -DU8G2_WITHOUT_DIRECT_GLYPH_DECODE \
+        -I../../u8g2Headers FontBench.c \
+        $(for f in $U8G2; do echo ../../u8g2/$f; done) \
+        -o FontBenchNoCache
+
+   and run both:
+
+     ./FontBenchNoCache && ./FontBench
+
+   The glyph cache and the font index are opt in, the first build defines
+   U8G2_WITH_GLYPH_CACHE and U8G2_WITH_FONT_INDEX for every source file.
+   The checksums must be the same for both builds.
+   Times are host times, so only the ratio between the two builds carries
+   over to the PIC32.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/16/20 17:40 kcao    started coding
+ 11/19/20 16:30 kcao    built without the fixed SSD1306 data path
+ 11/19/20 18:30 kcao    u8g2_span.c in the build, for the filled shapes
+ 11/20/20 10:30 kcao    glyph cache opt in, in a buffer of the bench
+ 11/20/20 12:30 kcao    font index opt in as well
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <time.h>
+
+#include "u8g2.h"
+
+/*----------------------------- Module Defines ----------------------------*/
+#define REPEATS 20000
+#define BUFFER_BYTES (128 * 8)
+
+/*---------------------------- Module Types -------------------------------*/
+typedef struct
+{
+  uint8_t x;
+  uint8_t y;
+  uint8_t Dir;        // u8g2_SetFontDirection
+  uint8_t Color;      // u8g2_SetDrawColor
+  const char *pText;
+}BenchString_t;
+
+/*---------------------------- Module Variables ---------------------------*/
+static u8g2_t u8g2;
+#ifdef U8G2_WITH_FONT_INDEX
+static uint16_t FontIndex[95];
+#endif
+#ifdef U8G2_WITH_GLYPH_CACHE
+static u8g2_glyph_cache_t GlyphCache;
+#endif
+
+// the strings and positions used by Display.c
+static const BenchString_t Strings[] = {
+  { 1, 15, 0, 1, " KEEP COPYING " },
+  { 1, 30, 0, 1, "  AND NOBODY  " },
+  { 1, 45, 0, 1, "   EXPLODES   " },
+  { 1, 60, 0, 1, " press button" },
+  { 45, 40, 0, 1, "READY" },
+  { 1, 15, 0, 1, "R12" },
+  { 90, 15, 0, 1, "1230" },
+  { 110, 60, 0, 1, "15" },
+  { 28, 40, 0, 1, "<" },
+  { 38, 40, 0, 0, "<" },
+  { 75, 40, 0, 1, ">" },
+  { 65, 15, 3, 1, ">" },
+  { 55, 45, 1, 1, ">" },
+  { 55, 40, 0, 1, "GO!" },
+  { 7, 40, 0, 1, "BOMB DEFUSED!" },
+  { 85, 35, 0, 1, "GAME" },
+  { 1, 12, 0, 1, "High Scores" },
+};
+
+/*------------------------------ Module Code ------------------------------*/
+static uint8_t NullByte(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+    void *arg_ptr)
+{
+  return 1;
+}
+
+static uint8_t NullGpio(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+    void *arg_ptr)
+{
+  return 1;
+}
+
+static double Now(void)
+{
+  struct timespec t;
+
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// FNV-1a over the frame buffer
+static uint32_t Checksum(void)
+{
+  const uint8_t *pBuf = u8g2_GetBufferPtr(&u8g2);
+  uint32_t Hash = 2166136261u;
+  int i;
+
+  for (i = 0; i < BUFFER_BYTES; i++)
+  {
+    Hash = (Hash ^ pBuf[i]) * 16777619u;
+  }
+  return Hash;
+}
+
+static void Prepare(const BenchString_t *pString)
+{
+  u8g2_SetFontDirection(&u8g2, pString->Dir);
+  u8g2_SetDrawColor(&u8g2, pString->Color);
+}
+
+int main(void)
+{
+  unsigned i;
+  unsigned n;
+  double Start;
+  double PerCall;
+  double Total = 0;
+  uint32_t Sum;
+
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, NullByte, NullGpio);
+#ifdef U8G2_WITH_FONT_INDEX
+  u8g2_SetFontIndexBuffer(&u8g2, FontIndex,
+      sizeof(FontIndex) / sizeof(FontIndex[0]));
+#endif
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2_SetGlyphCache(&u8g2, &GlyphCache);
+#endif
+  u8g2_SetFont(&u8g2, u8g2_font_t0_18_mr);
+  u8g2_SetFontMode(&u8g2, 0);
+  u8g2_SetFontRefHeightAll(&u8g2);
+
+#ifdef U8G2_WITH_GLYPH_CACHE
+  printf("glyph cache on, budget %d bytes / %d glyphs\n",
+      U8G2_GLYPH_CACHE_SIZE, U8G2_GLYPH_CACHE_GLYPHS);
+#else
+  printf("glyph cache off\n");
+#endif
+#ifdef U8G2_WITH_FONT_INDEX
+  printf("font index on\n");
+#else
+  printf("font index off\n");
+#endif
+#ifdef U8G2_WITH_DIRECT_GLYPH_DECODE
+  printf("direct glyph decode on\n");
+#else
+  printf("direct glyph decode off\n");
+#endif
+  printf("%-18s %10s %10s\n", "string", "ns/call", "checksum");
+  for (i = 0; i < sizeof(Strings) / sizeof(Strings[0]); i++)
+  {
+    // grey background, so solid mode has to clear as well as set
+    u8g2_ClearBuffer(&u8g2);
+    u8g2_SetDrawColor(&u8g2, 1);
+    u8g2_DrawBox(&u8g2, 0, 0, 128, 64);
+    u8g2_SetDrawColor(&u8g2, 2);
+    for (n = 0; n < 128; n += 2)
+    {
+      u8g2_DrawVLine(&u8g2, n, 0, 64);
+    }
+    Prepare(&Strings[i]);
+    u8g2_DrawStr(&u8g2, Strings[i].x, Strings[i].y, Strings[i].pText);
+    Sum = Checksum();
+
+    Start = Now();
+    for (n = 0; n < REPEATS; n++)
+    {
+      u8g2_DrawStr(&u8g2, Strings[i].x, Strings[i].y, Strings[i].pText);
+    }
+    PerCall = (Now() - Start) / REPEATS;
+    Total += PerCall;
+    printf("%-18s %10.0f   %08x%s\n", Strings[i].pText, PerCall, Sum,
+        Strings[i].Dir ? "  (rotated)" : "");
+    u8g2_SetFontDirection(&u8g2, 0);
+  }
+  printf("%-18s %10.0f\n", "all strings", Total);
+
+  Start = Now();
+  for (n = 0; n < REPEATS; n++)
+  {
+    Sum += u8g2_GetStrWidth(&u8g2, "BOMB DEFUSED!");
+  }
+  printf("%-18s %10.0f   (width %u)\n", "GetStrWidth",
+      (Now() - Start) / REPEATS, u8g2_GetStrWidth(&u8g2, "BOMB DEFUSED!"));
+#ifdef U8G2_WITH_GLYPH_CACHE
+  printf("cache holds %u glyphs in %u bytes\n", GlyphCache.glyph_cnt,
+      GlyphCache.bitmap_used);
+#endif
+  return 0;
+}
@@ -0,0 +1,345 @@
+/****************************************************************************
+ Module
+   FontSubset.c
+
+ Revision
+   1.0.0
+
+ Description
+   Host tool that cuts u8g2_font_t0_18_mr down to the glyphs the game draws
+   with it and writes the result as a u8g2 font of its own. All text drawn
+   with it is rendered ahead of time by Tools/ScreenGen: the static screen
+   text and the digit atlas the high scores are drawn from. Display.c only
+   draws u8x8 text and the atlas at run time. The character set is given
+   with -c, and can be taken from the string literals in source files as
+   well: their plain characters, plus the characters a printf conversion
+   can produce (%i and %d give "-0123456789").
+   Glyphs keep their bitmaps and the font header keeps the sizes of the
+   full font, so text looks exactly the same and the reference heights do
+   not change. Only the glyph count and the start offsets are rewritten.
+
+ Notes
+   Build and run from this directory:
+
+     cc -std=gnu99 -O2 -I../../u8g2Headers FontSubset.c \
+        ../../u8g2/u8g2_fonts.c -o FontSubset
+     ./FontSubset -c " !.0123456789<>ABCDEFGHIKLMNOPRSUVXYbceghinoprstu" \
+        u8g2_font_t0_18_game > ../ScreenGen/GameFont.c
+
+   The font is only built into ScreenGen, so it is written next to it.
+   The set is the text ScreenGen draws plus the digits of the atlas. Rerun
+   it, and then ScreenGen, whenever ScreenGen draws new text; ScreenGen
+   stops with an error on a character the font does not have. A %s or %c
+   conversion can not be scanned, its characters have to be given with -c.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/18/20 11:00 kcao    started coding
+ 11/18/20 17:30 kcao    character set of the ScreenGen text, Display.c no
+                        longer draws u8g2 font text
+ 11/20/20 12:00 kcao    GameFont.c written to Tools/ScreenGen
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "u8g2.h"
+
+/*----------------------------- Module Defines ----------------------------*/
+#define SOURCE_FONT u8g2_font_t0_18_mr
+#define SOURCE_FONT_NAME "u8g2_font_t0_18_mr"
+#define HEADER_BYTES 23     // U8G2_FONT_DATA_STRUCT_SIZE
+#define MAX_FONT_BYTES 4096
+#define BYTES_PER_LINE 16
+
+/*---------------------------- Module Functions ---------------------------*/
+static void AddChars(const char *pChars);
+static int ScanFile(const char *pFileName);
+static const char *ScanConversion(const char *pFormat);
+
+/*---------------------------- Module Variables ---------------------------*/
+// characters to keep, indexed by encoding
+static uint8_t Keep[256];
+static uint8_t Subset[MAX_FONT_BYTES];
+
+/*------------------------------ Module Code ------------------------------*/
+static void AddChars(const char *pChars)
+{
+  while (*pChars != '\0')
+  {
+    Keep[(uint8_t)*pChars] = 1;
+    pChars++;
+  }
+}
+
+// pFormat points behind a '%', adds what the conversion can print and
+// returns the conversion character
+static const char *ScanConversion(const char *pFormat)
+{
+  // flags, width, precision and length
+  while ((*pFormat != '\0') && (strchr("-+ #0123456789.*hlLqjzt", *pFormat) != NULL))
+  {
+    pFormat++;
+  }
+  switch (*pFormat)
+  {
+    case 'd':
+    case 'i':
+      AddChars("-0123456789");
+      break;
+    case 'u':
+      AddChars("0123456789");
+      break;
+    case 'x':
+      AddChars("0123456789abcdef");
+      break;
+    case 'X':
+      AddChars("0123456789ABCDEF");
+      break;
+    case '%':
+      AddChars("%");
+      break;
+    default:
+      fprintf(stderr, "warning: %%%c can not be scanned, use -c\n", *pFormat);
+      break;
+  }
+  return pFormat;
+}
+
+// adds the characters of every string literal in the file, comments and
+// preprocessor lines are skipped
+static int ScanFile(const char *pFileName)
+{
+  FILE *pFile;
+  char Line[512];
+  char Literal[512];
+  int InComment = 0;
+  char *p;
+  int n;
+  const char *q;
+
+  pFile = fopen(pFileName, "r");
+  if (pFile == NULL)
+  {
+    perror(pFileName);
+    return 0;
+  }
+  while (fgets(Line, sizeof(Line), pFile) != NULL)
+  {
+    p = Line;
+    if (!InComment)
+    {
+      while ((*p == ' ') || (*p == '\t'))
+      {
+        p++;
+      }
+      if (*p == '#')
+      {
+        continue;
+      }
+    }
+    while (*p != '\0')
+    {
+      if (InComment)
+      {
+        if ((p[0] == '*') && (p[1] == '/'))
+        {
+          InComment = 0;
+          p++;
+        }
+      }
+      else if ((p[0] == '/') && (p[1] == '*'))
+      {
+        InComment = 1;
+        p++;
+      }
+      else if ((p[0] == '/') && (p[1] == '/'))
+      {
+        break;
+      }
+      else if (*p == '\'')
+      {
+        // character constant, may be '"'
+        p++;
+        while ((*p != '\0') && (*p != '\''))
+        {
+          p += (*p == '\\') ? 2 : 1;
+        }
+      }
+      else if (*p == '"')
+      {
+        // collect the literal with its escapes resolved
+        p++;
+        n = 0;
+        while ((*p != '\0') && (*p != '"'))
+        {
+          if ((*p == '\\') && (p[1] != '\0'))
+          {
+            p++;
+          }
+          Literal[n++] = *p++;
+        }
+        Literal[n] = '\0';
+        for (q = Literal; *q != '\0'; q++)
+        {
+          if (*q == '%')
+          {
+            q = ScanConversion(q + 1);
+            if (*q == '\0')
+            {
+              break;
+            }
+          }
+          else if ((uint8_t)*q >= ' ')
+          {
+            Keep[(uint8_t)*q] = 1;
+          }
+        }
+        if (*p == '\0')
+        {
+          break;
+        }
+      }
+      p++;
+    }
+  }
+  fclose(pFile);
+  return 1;
+}
+
+static void PutWord(uint8_t *pBytes, uint16_t Word)
+{
+  pBytes[0] = Word >> 8;
+  pBytes[1] = Word & 0xff;
+}
+
+int main(int argc, char *argv[])
+{
+  const uint8_t *pFont = SOURCE_FONT;
+  const uint8_t *pGlyph;
+  const char *pName;
+  int Size;
+  int GlyphCount = 0;
+  int UpperA = -1;
+  int LowerA = -1;
+  int i;
+
+  i = 1;
+  while ((i + 1 < argc) && (strcmp(argv[i], "-c") == 0))
+  {
+    AddChars(argv[i + 1]);
+    i += 2;
+  }
+  if (i >= argc)
+  {
+    fprintf(stderr, "usage: %s [-c chars] fontname [file.c ...]\n", argv[0]);
+    return 2;
+  }
+  pName = argv[i++];
+  for (; i < argc; i++)
+  {
+    if (!ScanFile(argv[i]))
+    {
+      return 2;
+    }
+  }
+
+  // the header stays, then the glyphs 0..255 that are kept, in font order
+  memcpy(Subset, pFont, HEADER_BYTES);
+  Size = HEADER_BYTES;
+  for (pGlyph = pFont + HEADER_BYTES; pGlyph[1] != 0; pGlyph += pGlyph[1])
+  {
+    if (!Keep[pGlyph[0]])
+    {
+      continue;
+    }
+    // lookups for 'A' and up and 'a' and up start at the first glyph
+    // that is not below it
+    if ((UpperA < 0) && (pGlyph[0] >= 'A'))
+    {
+      UpperA = Size - HEADER_BYTES;
+    }
+    if ((LowerA < 0) && (pGlyph[0] >= 'a'))
+    {
+      LowerA = Size - HEADER_BYTES;
+    }
+    memcpy(&Subset[Size], pGlyph, pGlyph[1]);
+    Size += pGlyph[1];
+    GlyphCount++;
+    Keep[pGlyph[0]] = 2;
+  }
+  for (i = 0; i < 256; i++)
+  {
+    if (Keep[i] == 1)
+    {
+      fprintf(stderr, "warning: '%c' is not in " SOURCE_FONT_NAME "\n", i);
+    }
+  }
+  // a search that reaches the end marker finds nothing
+  if (UpperA < 0)
+  {
+    UpperA = Size - HEADER_BYTES;
+  }
+  if (LowerA < 0)
+  {
+    LowerA = Size - HEADER_BYTES;
+  }
+  Subset[0] = GlyphCount;
+  PutWord(&Subset[17], UpperA);
+  PutWord(&Subset[19], LowerA);
+  // end of glyphs 0..255, then an empty unicode section: a lookup table
+  // of one entry (table size 4, last encoding 0xffff) and the end marker
+  Subset[Size++] = 0;
+  Subset[Size++] = 0;
+  PutWord(&Subset[21], Size - HEADER_BYTES);
+  PutWord(&Subset[Size], 4);
+  PutWord(&Subset[Size + 2], 0xffff);
+  PutWord(&Subset[Size + 4], 0);
+  Size += 6;
+
+  printf("/*************************************************************"
+      "***************\n");
+  printf(" Module\n   GameFont.c\n\n");
+  printf(" Description\n");
+  printf("   " SOURCE_FONT_NAME " cut down to the screen text,"
+      " see GameFont.h\n");
+  printf("   Glyphs: %d/%d \"", GlyphCount, pFont[0]);
+  for (i = 0; i < 256; i++)
+  {
+    if (Keep[i] == 2)
+    {
+      printf((i == '"') || (i == '\\') ? "\\%c" : "%c", i);
+    }
+  }
+  printf("\"\n\n");
+  printf(" Notes\n");
+  printf("   Generated by Tools/FontSubset, do not edit\n");
+  printf("**************************************************************"
+      "**************/\n");
+  printf("#include \"GameFont.h\"\n\n");
+  printf("const uint8_t %s[%d] U8G2_FONT_SECTION(\"%s\") = {\n", pName, Size,
+      pName);
+  for (i = 0; i < Size; i++)
+  {
+    if ((i % BYTES_PER_LINE) == 0)
+    {
+      printf("  ");
+    }
+    printf("0x%02x,", Subset[i]);
+    if (((i % BYTES_PER_LINE) == (BYTES_PER_LINE - 1)) || (i == Size - 1))
+    {
+      printf("\n");
+    }
+    else
+    {
+      printf(" ");
+    }
+  }
+  printf("};\n");
+  printf("/*------------------------------ End of file -----------------"
+      "-------------*/\n");
+  fprintf(stderr, "%d of %d glyphs, %d bytes\n", GlyphCount, pFont[0], Size);
+  return 0;
+}
@@ -0,0 +1,401 @@
+/****************************************************************************
+ Module
+   RleGen.c
+
+ Revision
+   1.0.0
+
+ Description
+   Host tool that turns 128x64 PBM images into run length coded frames for
+   u8g2_DrawRleFrame (see u8g2_rle.c for the format) and writes them out
+   as C. The first image is a frame of the whole screen, every image after
+   it a delta against the one before, covering only the pages which change,
+   so a list of images becomes an animation: draw frame 0, then each of the
+   others over it in turn.
+   Every frame is decoded again with u8g2_DrawRleFrame and compared with
+   its image before it is written.
+
+ Notes
+   Build and run from this directory:
+
+     U8G2="u8g2_buffer.c u8g2_ll_hvline.c u8g2_setup.c u8g2_d_setup.c \
+           u8g2_d_memory.c u8g2_font.c u8g2_hvline.c u8g2_bitmap.c \
+           u8g2_intersection.c u8g2_kerning.c u8g2_rle.c \
+           u8x8_8x8.c u8x8_setup.c u8x8_display.c u8x8_cad.c u8x8_byte.c \
+           u8x8_gpio.c u8x8_u16toa.c u8x8_d_ssd1306_128x64_noname.c"
+     cc -std=gnu99 -O2 -DU8X8_WITHOUT_FIXED_SSD1306_SPI \
+        -I../../u8g2Headers RleGen.c \
+        $(for f in $U8G2; do echo ../../u8g2/$f; done) -o RleGen
+     ./RleGen BombAnim bomb0.pbm bomb1.pbm bomb2.pbm > BombAnim.c
+
+   The images have to be 128x64 PBM, plain (P1) or raw (P4); black pixels
+   are lit. Convert a PNG first, with netpbm or ImageMagick:
+
+     pngtopnm bomb0.png | pgmtopbm > bomb0.pbm
+     convert bomb0.png -monochrome bomb0.pbm
+
+   The output defines <Name>0, <Name>1, ... and the table
+   const uint8_t *const <Name>[], declare it where it is used.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/19/20 17:30 kcao    started coding
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "u8g2.h"
+
+/*----------------------------- Module Defines ----------------------------*/
+#define WIDTH 128
+#define HEIGHT 64
+#define IMAGE_BYTES (WIDTH * HEIGHT / 8)
+#define BYTES_PER_LINE 16
+#define MAX_OP 64                 // bytes of one code
+#define MIN_RUN 3                 // shorter runs are cheaper as literals
+#define MIN_SKIP 2                // a single unchanged byte goes in a literal
+// a frame never grows by more than one code per MAX_OP bytes
+#define MAX_FRAME (2 + IMAGE_BYTES + IMAGE_BYTES / MAX_OP + 1)
+
+/*---------------------------- Module Functions ---------------------------*/
+static int ReadPbm(const char *pFile, uint8_t *pImage);
+static int Encode(uint8_t *pOut, const uint8_t *pImage, const uint8_t *pPrev);
+static int Check(const uint8_t *pFrame, const uint8_t *pImage,
+    const uint8_t *pPrev);
+static void WriteBytes(const uint8_t *pBytes, int Count);
+
+/*---------------------------- Module Variables ---------------------------*/
+static u8g2_t u8g2;
+static uint8_t Image[IMAGE_BYTES];
+static uint8_t Prev[IMAGE_BYTES];
+static uint8_t Frame[MAX_FRAME];
+
+/*------------------------------ Module Code ------------------------------*/
+static uint8_t NullByte(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+    void *arg_ptr)
+{
+  return 1;
+}
+
+static uint8_t NullGpio(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+    void *arg_ptr)
+{
+  return 1;
+}
+
+// skips white space and comments in a PBM header
+static void SkipSpace(FILE *f)
+{
+  int c;
+
+  while ((c = getc(f)) != EOF)
+  {
+    if (c == '#')
+    {
+      while ((c = getc(f)) != EOF && c != '\n')
+      {
+      }
+    }
+    else if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+    {
+      ungetc(c, f);
+      return;
+    }
+  }
+}
+
+// reads a 128x64 PBM into pImage in buffer order: 8 pages of 128 column
+// bytes, LSB at the top, returns 0 if it is not one
+static int ReadPbm(const char *pFile, uint8_t *pImage)
+{
+  FILE *f = fopen(pFile, "rb");
+  int Raw;
+  int w, h;
+  int x, y;
+  int c;
+  int Pixel = 0;
+
+  if (f == NULL)
+  {
+    fprintf(stderr, "%s: cannot open\n", pFile);
+    return 0;
+  }
+  if (getc(f) != 'P' || ((c = getc(f)) != '1' && c != '4'))
+  {
+    fprintf(stderr, "%s: not a PBM (P1 or P4)\n", pFile);
+    fclose(f);
+    return 0;
+  }
+  Raw = (c == '4');
+  SkipSpace(f);
+  if (fscanf(f, "%d", &w) != 1)
+  {
+    w = 0;
+  }
+  SkipSpace(f);
+  if (fscanf(f, "%d", &h) != 1)
+  {
+    h = 0;
+  }
+  if (w != WIDTH || h != HEIGHT)
+  {
+    fprintf(stderr, "%s: %dx%d, has to be %dx%d\n", pFile, w, h, WIDTH,
+        HEIGHT);
+    fclose(f);
+    return 0;
+  }
+  // a raw image starts after exactly one white space character
+  getc(f);
+
+  memset(pImage, 0, IMAGE_BYTES);
+  for (y = 0; y < HEIGHT; y++)
+  {
+    for (x = 0; x < WIDTH; x++)
+    {
+      if (Raw)
+      {
+        if ((x % 8) == 0)
+        {
+          c = getc(f);
+        }
+        Pixel = (c >> (7 - (x % 8))) & 1;
+      }
+      else
+      {
+        SkipSpace(f);
+        c = getc(f);
+        Pixel = (c == '1');
+      }
+      if (c == EOF)
+      {
+        fprintf(stderr, "%s: too short\n", pFile);
+        fclose(f);
+        return 0;
+      }
+      if (Pixel)
+      {
+        pImage[(y / 8) * WIDTH + x] |= 1 << (y % 8);
+      }
+    }
+  }
+  fclose(f);
+  return 1;
+}
+
+// number of bytes from i on, up to End, which are the same in both images
+static int CountSame(const uint8_t *pImage, const uint8_t *pPrev, int i,
+    int End)
+{
+  int n = 0;
+
+  while (i + n < End && pImage[i + n] == pPrev[i + n])
+  {
+    n++;
+  }
+  return n;
+}
+
+// number of bytes from i on, up to End and MAX_OP, equal to the one at i
+static int CountRun(const uint8_t *pImage, int i, int End)
+{
+  int n = 1;
+
+  while (i + n < End && n < MAX_OP && pImage[i + n] == pImage[i])
+  {
+    n++;
+  }
+  return n;
+}
+
+// codes the image into pOut, all of it if pPrev is NULL, else the pages
+// which differ from pPrev, and returns the number of bytes
+static int Encode(uint8_t *pOut, const uint8_t *pImage, const uint8_t *pPrev)
+{
+  int First = 0;
+  int Last = HEIGHT / 8 - 1;
+  int Len = 2;
+  int i, End;
+  int n, k;
+
+  if (pPrev != NULL)
+  {
+    First = HEIGHT / 8;
+    Last = -1;
+    for (i = 0; i < IMAGE_BYTES; i++)
+    {
+      if (pImage[i] != pPrev[i])
+      {
+        First = (i / WIDTH) < First ? (i / WIDTH) : First;
+        Last = i / WIDTH;
+      }
+    }
+    if (Last < 0)
+    {
+      // nothing changes: a frame of no pages
+      pOut[0] = 0;
+      pOut[1] = 0;
+      return 2;
+    }
+  }
+  pOut[0] = First;
+  pOut[1] = Last - First + 1;
+  i = First * WIDTH;
+  End = (Last + 1) * WIDTH;
+
+  while (i < End)
+  {
+    n = (pPrev != NULL) ? CountSame(pImage, pPrev, i, End) : 0;
+    if (n >= MIN_SKIP || (n > 0 && i + n == End))
+    {
+      i += n;
+      while (n >= MAX_OP)
+      {
+        k = n / MAX_OP < MAX_OP ? n / MAX_OP : MAX_OP;
+        pOut[Len++] = 0xC0 | (k - 1);
+        n -= k * MAX_OP;
+      }
+      if (n > 0)
+      {
+        pOut[Len++] = 0x80 | (n - 1);
+      }
+      continue;
+    }
+    n = CountRun(pImage, i, End);
+    if (n >= MIN_RUN)
+    {
+      pOut[Len++] = 0x40 | (n - 1);
+      pOut[Len++] = pImage[i];
+      i += n;
+      continue;
+    }
+    // literal up to the next run or skip
+    n = 1;
+    while (i + n < End && n < MAX_OP &&
+        CountRun(pImage, i + n, End) < MIN_RUN &&
+        (pPrev == NULL || CountSame(pImage, pPrev, i + n, End) < MIN_SKIP))
+    {
+      n++;
+    }
+    pOut[Len++] = n - 1;
+    memcpy(pOut + Len, pImage + i, n);
+    Len += n;
+    i += n;
+  }
+  return Len;
+}
+
+// draws the frame over pPrev (over a cleared buffer if NULL) and checks
+// that the result is the image
+static int Check(const uint8_t *pFrame, const uint8_t *pImage,
+    const uint8_t *pPrev)
+{
+  uint8_t *pBuf = u8g2_GetBufferPtr(&u8g2);
+
+  if (pPrev != NULL)
+  {
+    memcpy(pBuf, pPrev, IMAGE_BYTES);
+  }
+  else
+  {
+    memset(pBuf, 0x55, IMAGE_BYTES);
+  }
+  u8g2_DrawRleFrame(&u8g2, pFrame);
+  return memcmp(pBuf, pImage, IMAGE_BYTES) == 0;
+}
+
+static void WriteBytes(const uint8_t *pBytes, int Count)
+{
+  int i;
+
+  for (i = 0; i < Count; i++)
+  {
+    if ((i % BYTES_PER_LINE) == 0)
+    {
+      printf("  ");
+    }
+    printf("0x%02x,", pBytes[i]);
+    if (((i % BYTES_PER_LINE) == (BYTES_PER_LINE - 1)) || (i == Count - 1))
+    {
+      printf("\n");
+    }
+    else
+    {
+      printf(" ");
+    }
+  }
+}
+
+int main(int argc, char *argv[])
+{
+  const char *pName;
+  int Frames;
+  int Len;
+  int Total = 0;
+  int i;
+
+  if (argc < 3)
+  {
+    fprintf(stderr, "usage: RleGen Name frame0.pbm [frame1.pbm ...]\n");
+    return 1;
+  }
+  pName = argv[1];
+  Frames = argc - 2;
+
+  // same display as InitDisplay, full buffer for the check
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, NullByte, NullGpio);
+
+  printf("/*************************************************************"
+      "***************\n");
+  printf(" Module\n   %s.c\n\n", pName);
+  printf(" Description\n");
+  printf("   Run length coded frames for u8g2_DrawRleFrame: frame 0 is the"
+      " whole\n   screen, each frame after it a delta against the one"
+      " before\n\n");
+  printf(" Notes\n");
+  printf("   Generated by Tools/RleGen, do not edit\n");
+  printf("**************************************************************"
+      "**************/\n");
+  printf("#include <stdint.h>\n");
+  for (i = 0; i < Frames; i++)
+  {
+    if (!ReadPbm(argv[i + 2], Image))
+    {
+      return 1;
+    }
+    Len = Encode(Frame, Image, i > 0 ? Prev : NULL);
+    if (!Check(Frame, Image, i > 0 ? Prev : NULL))
+    {
+      fprintf(stderr, "%s: frame does not decode to the image\n",
+          argv[i + 2]);
+      return 1;
+    }
+    if (Frame[1] == 0)
+    {
+      printf("\n// %s, no change\n", argv[i + 2]);
+    }
+    else
+    {
+      printf("\n// %s, pages %d to %d, %d bytes\n", argv[i + 2], Frame[0],
+          Frame[0] + Frame[1] - 1, Len);
+    }
+    printf("static const uint8_t %s%d[] = {\n", pName, i);
+    WriteBytes(Frame, Len);
+    printf("};\n");
+    memcpy(Prev, Image, IMAGE_BYTES);
+    Total += Len;
+  }
+  printf("\nconst uint8_t *const %s[%d] = {\n", pName, Frames);
+  for (i = 0; i < Frames; i++)
+  {
+    printf("  %s%d,\n", pName, i);
+  }
+  printf("};\n");
+  printf("/*------------------------------ End of file -----------------"
+      "-------------*/\n");
+  fprintf(stderr, "%d frames, %d bytes (%d uncoded)\n", Frames, Total,
+      Frames * IMAGE_BYTES);
+  return 0;
+}
@@ -0,0 +1,76 @@
+/****************************************************************************
+ Module
+   GameFont.c
+
+ Description
+   u8g2_font_t0_18_mr cut down to the screen text, see GameFont.h
+   Glyphs: 49/95 " !.0123456789<>ABCDEFGHIKLMNOPRSUVXYbceghinoprstu"
+
+ Notes
+   Generated by Tools/FontSubset, do not edit
+****************************************************************************/
+#include "GameFont.h"
+
+const uint8_t u8g2_font_t0_18_game[958] U8G2_FONT_SECTION("u8g2_font_t0_18_game") = {
+  0x31, 0x02, 0x04, 0x02, 0x04, 0x05, 0x01, 0x03, 0x05, 0x09, 0x11, 0x00, 0xfd, 0x0b, 0xfd, 0x0c,
+  0xff, 0x00, 0xf7, 0x02, 0xb3, 0x03, 0xa1, 0x20, 0x08, 0x19, 0x27, 0x3f, 0xff, 0x0d, 0x00, 0x21,
+  0x0d, 0x19, 0x27, 0x3f, 0x45, 0xb0, 0xdf, 0x43, 0x82, 0x79, 0x0a, 0x00, 0x2e, 0x0a, 0x19, 0x27,
+  0x3f, 0x3f, 0xd3, 0xe9, 0x29, 0x00, 0x30, 0x18, 0x19, 0x27, 0x3f, 0x81, 0x2c, 0x12, 0xaa, 0x09,
+  0x65, 0x42, 0x99, 0x50, 0x26, 0x94, 0x09, 0x65, 0x42, 0x25, 0x31, 0x3d, 0x05, 0x00, 0x31, 0x0e,
+  0x19, 0x27, 0x3f, 0x45, 0x4e, 0x96, 0x48, 0x45, 0x82, 0xfd, 0x9e, 0x02, 0x32, 0x10, 0x19, 0x27,
+  0x3f, 0x7c, 0x10, 0xaa, 0x09, 0x05, 0xeb, 0x7a, 0x38, 0xd8, 0xc3, 0x01, 0x33, 0x11, 0x19, 0x27,
+  0x3f, 0x7c, 0x10, 0x2a, 0xac, 0x8b, 0x2d, 0x83, 0x35, 0xa1, 0xd0, 0x20, 0x4f, 0x34, 0x13, 0x19,
+  0x27, 0x3f, 0x49, 0xce, 0x2c, 0x91, 0x8a, 0xa4, 0x22, 0xa1, 0x4c, 0x68, 0xb0, 0x0b, 0xd6, 0x13,
+  0x35, 0x12, 0x19, 0x27, 0x3f, 0x7a, 0x20, 0x0a, 0x56, 0xa8, 0x24, 0xa1, 0xc2, 0x36, 0x55, 0x7b,
+  0x0a, 0x00, 0x36, 0x15, 0x19, 0x27, 0x3f, 0xc1, 0x2a, 0x17, 0xac, 0x18, 0x69, 0x8a, 0x32, 0xa1,
+  0x4c, 0x28, 0x13, 0x0a, 0x0d, 0xf2, 0x04, 0x37, 0x11, 0x19, 0x27, 0x3f, 0x7a, 0xb0, 0x09, 0x05,
+  0x73, 0xc1, 0x5c, 0xb0, 0x2e, 0x58, 0x4f, 0x02, 0x38, 0x18, 0x19, 0x27, 0x3f, 0x7c, 0x10, 0xaa,
+  0x09, 0x65, 0x42, 0x25, 0xa9, 0x41, 0xa8, 0x26, 0x94, 0x09, 0x65, 0x42, 0xa1, 0x41, 0x9e, 0x00,
+  0x39, 0x16, 0x19, 0x27, 0x3f, 0x7c, 0x10, 0xaa, 0x09, 0x65, 0x42, 0x99, 0x50, 0x26, 0x23, 0x5a,
+  0x04, 0xeb, 0x52, 0x7b, 0x0a, 0x00, 0x3c, 0x0c, 0x19, 0x27, 0x3f, 0x71, 0xae, 0xc3, 0x64, 0xf7,
+  0x70, 0x00, 0x3e, 0x0c, 0x19, 0x27, 0x3f, 0x61, 0xb2, 0xc3, 0x5c, 0xf7, 0x34, 0x00, 0x41, 0x17,
+  0x19, 0x27, 0x3f, 0x45, 0xb0, 0x2e, 0x11, 0x4b, 0xa4, 0x32, 0xa1, 0x4c, 0x68, 0xa0, 0x49, 0x45,
+  0x52, 0x91, 0x54, 0x1e, 0x0d, 0x42, 0x18, 0x19, 0x27, 0x3f, 0x7a, 0x20, 0xaa, 0x09, 0x65, 0x42,
+  0x99, 0xa2, 0x81, 0xa8, 0x26, 0x94, 0x09, 0x65, 0x42, 0x99, 0x81, 0x9e, 0x00, 0x43, 0x0e, 0x19,
+  0x27, 0x3f, 0xc1, 0x2a, 0x53, 0xd8, 0x97, 0x99, 0xd4, 0x9e, 0x00, 0x44, 0x19, 0x19, 0x27, 0x3f,
+  0x7a, 0x90, 0xca, 0x84, 0x6a, 0x42, 0x99, 0x50, 0x26, 0x94, 0x09, 0x65, 0x42, 0x99, 0x50, 0xa6,
+  0x68, 0x90, 0xa7, 0x00, 0x45, 0x11, 0x19, 0x27, 0x3f, 0x7a, 0xb0, 0x09, 0x36, 0x1c, 0xa4, 0x82,
+  0x0d, 0x07, 0x7b, 0x38, 0x00, 0x46, 0x0f, 0x19, 0x27, 0x3f, 0x7c, 0xb0, 0x09, 0x36, 0x1c, 0xa4,
+  0x82, 0xdd, 0xd3, 0x00, 0x47, 0x14, 0x19, 0x27, 0x3f, 0xc1, 0x2a, 0x53, 0xd8, 0x64, 0x13, 0xca,
+  0x84, 0x32, 0xa1, 0x9a, 0xd4, 0x20, 0x0f, 0x07, 0x48, 0x1b, 0x19, 0x27, 0x3f, 0x3a, 0x94, 0x09,
+  0x65, 0x42, 0x99, 0x50, 0x26, 0x94, 0x19, 0x6c, 0x42, 0x99, 0x50, 0x26, 0x94, 0x09, 0x65, 0x42,
+  0x79, 0x38, 0x00, 0x49, 0x0d, 0x19, 0x27, 0x3f, 0x7c, 0x20, 0x0b, 0xf6, 0x67, 0x03, 0x3d, 0x1c,
+  0x4b, 0x19, 0x19, 0x27, 0x3f, 0x3a, 0x94, 0x09, 0x65, 0x8a, 0x32, 0xa1, 0x48, 0x2a, 0x11, 0x53,
+  0xa4, 0x32, 0xa1, 0x4c, 0xa8, 0x26, 0x94, 0x87, 0x03, 0x4c, 0x0c, 0x19, 0x27, 0x3f, 0x3a, 0xd8,
+  0x3f, 0x1c, 0xec, 0xe1, 0x00, 0x4d, 0x18, 0x19, 0x27, 0x3f, 0x3a, 0x15, 0x49, 0x45, 0x34, 0x12,
+  0x8d, 0x24, 0xd1, 0x24, 0xd1, 0xa4, 0x5f, 0x45, 0x52, 0x91, 0x54, 0x1e, 0x0d, 0x4e, 0x1c, 0x19,
+  0x27, 0x3f, 0x3a, 0x94, 0x09, 0x65, 0x34, 0x19, 0x4d, 0x45, 0x24, 0x13, 0x49, 0x64, 0x22, 0x89,
+  0x4c, 0x46, 0x93, 0xd1, 0x84, 0x32, 0xa1, 0x3c, 0x1c, 0x4f, 0x19, 0x19, 0x27, 0x3f, 0x7c, 0x10,
+  0xaa, 0x09, 0x65, 0x42, 0x99, 0x50, 0x26, 0x94, 0x09, 0x65, 0x42, 0x99, 0x50, 0x26, 0x14, 0x1a,
+  0xe4, 0x09, 0x50, 0x13, 0x19, 0x27, 0x3f, 0x7a, 0x20, 0xaa, 0x09, 0x65, 0x42, 0x99, 0x50, 0x66,
+  0x20, 0x0a, 0x76, 0x4f, 0x04, 0x52, 0x19, 0x19, 0x27, 0x3f, 0x7a, 0x20, 0xaa, 0x09, 0x65, 0x42,
+  0x99, 0x50, 0x66, 0x20, 0x8a, 0xa4, 0x32, 0xa1, 0x4c, 0xa8, 0x26, 0x94, 0x87, 0x03, 0x53, 0x12,
+  0x19, 0x27, 0x3f, 0x7c, 0x10, 0xaa, 0x09, 0x26, 0x93, 0xca, 0xc2, 0x4c, 0x28, 0x34, 0xc8, 0x13,
+  0x55, 0x1a, 0x19, 0x27, 0x3f, 0x3a, 0x94, 0x09, 0x65, 0x42, 0x99, 0x50, 0x26, 0x94, 0x09, 0x65,
+  0x42, 0x99, 0x50, 0x26, 0x94, 0x09, 0x85, 0x06, 0x79, 0x02, 0x56, 0x17, 0x19, 0x27, 0x3f, 0x3a,
+  0x15, 0x49, 0x45, 0x52, 0x99, 0xa2, 0x4c, 0x28, 0x93, 0x4a, 0xc4, 0x12, 0xb9, 0x60, 0x3d, 0x05,
+  0x00, 0x58, 0x16, 0x19, 0x27, 0x3f, 0x3a, 0x94, 0x09, 0x95, 0xa4, 0x22, 0x31, 0x9d, 0x59, 0x24,
+  0x15, 0x09, 0xd5, 0x84, 0xf2, 0x70, 0x00, 0x59, 0x13, 0x19, 0x27, 0x3f, 0x3a, 0x15, 0x49, 0x65,
+  0x8a, 0x32, 0xa9, 0x44, 0x2c, 0x91, 0x0b, 0x76, 0x4f, 0x01, 0x62, 0x14, 0x19, 0x27, 0x3f, 0x3a,
+  0xd8, 0x62, 0xa4, 0x29, 0xca, 0x84, 0x32, 0xa1, 0x4c, 0x28, 0xa3, 0xa9, 0xd8, 0x13, 0x63, 0x0d,
+  0x19, 0x27, 0x3f, 0xe3, 0x55, 0xa6, 0xb0, 0x65, 0x26, 0xb5, 0x27, 0x65, 0x11, 0x19, 0x27, 0x3f,
+  0xe3, 0x55, 0xa6, 0x28, 0x33, 0xd8, 0x04, 0x93, 0x99, 0xd4, 0x9e, 0x00, 0x67, 0x17, 0x19, 0x27,
+  0x3f, 0xdb, 0x45, 0xa6, 0x28, 0x13, 0xca, 0x84, 0x32, 0xa9, 0x55, 0x72, 0x10, 0xaa, 0x09, 0x85,
+  0x06, 0x19, 0x00, 0x68, 0x16, 0x19, 0x27, 0x3f, 0x3a, 0xd8, 0x62, 0xa4, 0x29, 0xca, 0x84, 0x32,
+  0xa1, 0x4c, 0x28, 0x13, 0xca, 0x84, 0xf2, 0x70, 0x00, 0x69, 0x0e, 0x19, 0x27, 0x3f, 0x2e, 0x98,
+  0x87, 0x0a, 0xfb, 0x6c, 0xa0, 0x87, 0x03, 0x6e, 0x15, 0x19, 0x27, 0x3f, 0xd3, 0xc4, 0x48, 0x53,
+  0x94, 0x09, 0x65, 0x42, 0x99, 0x50, 0x26, 0x94, 0x09, 0xe5, 0xe1, 0x00, 0x6f, 0x14, 0x19, 0x27,
+  0x3f, 0xdb, 0x41, 0xa8, 0x26, 0x94, 0x09, 0x65, 0x42, 0x99, 0x50, 0x26, 0x14, 0x1a, 0xe4, 0x09,
+  0x70, 0x15, 0x19, 0x27, 0x3f, 0xd3, 0xc4, 0x48, 0x53, 0x94, 0x09, 0x65, 0x42, 0x99, 0x50, 0x46,
+  0x53, 0x31, 0x0a, 0xd6, 0x01, 0x72, 0x0d, 0x19, 0x27, 0x3f, 0x53, 0xc5, 0x48, 0x12, 0x0a, 0xf6,
+  0x9e, 0x06, 0x73, 0x10, 0x19, 0x27, 0x3f, 0xdb, 0x41, 0xa8, 0x26, 0x69, 0x99, 0x09, 0x85, 0x06,
+  0x79, 0x02, 0x74, 0x0e, 0x19, 0x27, 0x3f, 0x65, 0x30, 0x36, 0x90, 0x05, 0x7b, 0x12, 0xd3, 0x13,
+  0x75, 0x16, 0x19, 0x27, 0x3f, 0xd3, 0x50, 0x26, 0x94, 0x09, 0x65, 0x42, 0x99, 0x50, 0x26, 0x94,
+  0xc9, 0x88, 0x16, 0x79, 0x38, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x00, 0x00,
+};
+/*------------------------------ End of file ------------------------------*/
@@ -0,0 +1,22 @@
+/****************************************************************************
+
+  Header file for the font of the screen text
+
+  u8g2_font_t0_18_mr with only the glyphs drawn from it: the static text
+  of the screens and the digits of the atlas, all rendered ahead of time
+  by ScreenGen into ScreenImages. It is only built into ScreenGen, the
+  firmware never draws with it. Generated by Tools/FontSubset from a
+  declared character set. Glyph sizes and the font header are those of
+  the full font, so the text and the reference heights do not change.
+
+ ****************************************************************************/
+
+#ifndef GameFont_H
+#define GameFont_H
+
+#include <stdint.h>
+#include "u8g2.h"
+
+extern const uint8_t u8g2_font_t0_18_game[] U8G2_FONT_SECTION("u8g2_font_t0_18_game");
+
+#endif /* GameFont_H */
@@ -0,0 +1,427 @@
+/****************************************************************************
+ Module
+   ScreenGen.c
+
+ Revision
+   1.0.0
+
+ Description
+   Host tool that draws the parts of the game screens which never change
+   (titles, the arrow cross, ...) with u8g2, exactly as Display.c used to
+   draw them, and writes each one out as a 1 KB full buffer image. The
+   output is ProjectSource/ScreenImages.c, whose const arrays live in flash.
+   Display.c copies an image into the buffer with u8g2_ComposeBuffer and
+   only draws the high scores and highlighted arrow on top.
+   For the arrows it also writes one sprite per instruction: the page
+   aligned box around the arrows that change when they are highlighted, as
+   they look in ArrowsImage and as they look highlighted.
+   The high scores are drawn with u8g2_DrawDigits from DigitAtlas, the
+   digits of the font rendered once into cells of the font's advance.
+   All text is drawn with u8g2_font_t0_18_game (GameFont.c next to it),
+   the glyphs of this text cut out of u8g2_font_t0_18_mr by FontSubset.
+
+ Notes
+   Build and run from this directory:
+
+     U8G2="u8g2_buffer.c u8g2_ll_hvline.c u8g2_setup.c u8g2_d_setup.c \
+           u8g2_d_memory.c u8g2_font.c u8g2_hvline.c \
+           u8g2_bitmap.c \
+           u8g2_box.c u8g2_circle.c u8g2_intersection.c u8g2_kerning.c \
+           u8g2_span.c \
+           u8x8_8x8.c u8x8_setup.c u8x8_display.c u8x8_cad.c u8x8_byte.c \
+           u8x8_gpio.c u8x8_u16toa.c u8x8_d_ssd1306_128x64_noname.c"
+     cc -std=gnu99 -O2 -DU8X8_WITHOUT_FIXED_SSD1306_SPI \
+        -DU8G2_WITH_FONT_INDEX -I../../u8g2Headers ScreenGen.c GameFont.c \
+        $(for f in $U8G2; do echo ../../u8g2/$f; done) -o ScreenGen
+     ./ScreenGen > ../../ProjectSource/ScreenImages.c
+
+   Rerun it whenever a static part of a screen, the font or its settings
+   change. New text may need new glyphs: ScreenGen stops with an error on
+   a character GameFont does not have, then rerun FontSubset first.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/17/20 14:10 kcao    started coding
+ 11/17/20 16:00 kcao    arrow sprites, normal and highlighted
+ 11/18/20 17:30 kcao    digit atlas, high score places in GameOverImage
+ 11/19/20 16:30 kcao    built without the fixed SSD1306 data path
+ 11/19/20 18:30 kcao    u8g2_span.c in the build, for the filled shapes
+ 11/20/20 10:00 kcao    text drawn with the GameFont subset, checked glyphs
+ 11/20/20 12:00 kcao    GameFont kept here, it is only built into ScreenGen
+ 11/20/20 12:30 kcao    font index opt in, defined for the build
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "u8g2.h"
+#include "GameFont.h"
+
+/*----------------------------- Module Defines ----------------------------*/
+#define IMAGE_BYTES (128 * 8)
+#define BYTES_PER_LINE 16
+#define NUM_ARROWS 8
+#define NUM_INPUTS 9
+#define ATLAS_CELLS 11      // digits 0 to 9 and a blank
+
+/*---------------------------- Module Types -------------------------------*/
+// one arrow of the cross: baseline, font direction and glyph
+typedef struct
+{
+  uint8_t x;
+  uint8_t y;
+  uint8_t Dir;
+  const char *pGlyph;
+}Arrow_t;
+
+typedef struct
+{
+  const char *pName;        // name of the const array
+  const char *pComment;     // what the image shows
+  void (*Draw)(void);
+}Image_t;
+
+/*---------------------------- Module Functions ---------------------------*/
+static void DrawText(u8g2_uint_t x, u8g2_uint_t y, const char *pText);
+static void DrawWelcome(void);
+static void DrawReady(void);
+static void DrawGo(void);
+static void DrawArrows(void);
+static void DrawHighlighted(uint8_t Input);
+static void DrawDefused(void);
+static void DrawGameOver(void);
+static void WriteDigitAtlas(void);
+
+/*---------------------------- Module Variables ---------------------------*/
+static u8g2_t u8g2;
+static uint8_t Normal[IMAGE_BYTES];
+#ifdef U8G2_WITH_FONT_INDEX
+// glyph lookup table for u8g2_font_t0_18_game, one word per glyph from ' '
+// up to its last glyph, big enough for any subset up to '~'
+static uint16_t FontIndex[95];
+#endif
+
+static const Arrow_t Arrows[NUM_ARROWS] = {
+  { 65, 15, 3, ">" },   // super up
+  { 65, 25, 3, ">" },   // up
+  { 28, 40, 0, "<" },   // super left
+  { 38, 40, 0, "<" },   // left
+  { 75, 40, 0, ">" },   // right
+  { 85, 40, 0, ">" },   // super right
+  { 55, 45, 1, ">" },   // down
+  { 55, 55, 1, ">" },   // super down
+};
+
+// arrows highlighted for each instruction/input, bit n is Arrows[n]
+static const uint8_t Highlights[NUM_INPUTS] = {
+  0x08,                 // LEFT
+  0x0C,                 // SUPER LEFT
+  0x10,                 // RIGHT
+  0x30,                 // SUPER RIGHT
+  0x02,                 // UP
+  0x03,                 // SUPER UP
+  0x40,                 // DOWN
+  0xC0,                 // SUPER DOWN
+  0x00,                 // BLANK
+};
+
+static const Image_t Images[] = {
+  { "WelcomeImage", "title and start prompt", DrawWelcome },
+  { "ReadyImage", "READY", DrawReady },
+  { "GoImage", "GO!", DrawGo },
+  { "ArrowsImage", "arrow cross, nothing highlighted", DrawArrows },
+  { "DefusedImage", "BOMB DEFUSED!", DrawDefused },
+  { "GameOverImage", "GAME OVER and the high score title", DrawGameOver },
+};
+
+/*------------------------------ Module Code ------------------------------*/
+static uint8_t NullByte(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+    void *arg_ptr)
+{
+  return 1;
+}
+
+static uint8_t NullGpio(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
+    void *arg_ptr)
+{
+  return 1;
+}
+
+// draws the text, every character of it has to be in the font: a glyph
+// which is not would silently be left out of the image
+static void DrawText(u8g2_uint_t x, u8g2_uint_t y, const char *pText)
+{
+  const char *p;
+
+  for (p = pText; *p != '\0'; p++)
+  {
+    if (!u8g2_IsGlyph(&u8g2, (uint8_t)*p))
+    {
+      fprintf(stderr, "'%c' of \"%s\" is not in the font, rerun "
+          "FontSubset with it\n", *p, pText);
+      exit(1);
+    }
+  }
+  u8g2_DrawStr(&u8g2, x, y, pText);
+}
+
+static void DrawWelcome(void)
+{
+  DrawText(1, 15, " KEEP COPYING ");
+  DrawText(1, 30, "  AND NOBODY  ");
+  DrawText(1, 45, "   EXPLODES   ");
+  DrawText(1, 60, " press button");
+}
+
+static void DrawReady(void)
+{
+  DrawText(45, 40, "READY");
+}
+
+static void DrawGo(void)
+{
+  DrawText(55, 40, "GO!");
+}
+
+static void DrawArrows(void)
+{
+  DrawHighlighted(NUM_INPUTS - 1);
+}
+
+// draws the arrow cross the way Display.c used to, in order, with the arrows
+// for Input in draw color 0
+static void DrawHighlighted(uint8_t Input)
+{
+  uint8_t i;
+
+  for (i = 0; i < NUM_ARROWS; i++)
+  {
+    u8g2_SetDrawColor(&u8g2, (Highlights[Input] & (1 << i)) ? 0 : 1);
+    u8g2_SetFontDirection(&u8g2, Arrows[i].Dir);
+    DrawText(Arrows[i].x, Arrows[i].y, Arrows[i].pGlyph);
+  }
+  u8g2_SetFontDirection(&u8g2, 0);
+  u8g2_SetDrawColor(&u8g2, 1);
+}
+
+static void DrawDefused(void)
+{
+  DrawText(7, 40, "BOMB DEFUSED!");
+}
+
+static void DrawGameOver(void)
+{
+  DrawText(85, 35, "GAME");
+  DrawText(85, 50, "OVER");
+  DrawText(1, 12, "High Scores");
+  // the scores themselves follow at run time, from DigitAtlas
+  DrawText(1, 30, "1.");
+  DrawText(1, 45, "2.");
+  DrawText(1, 60, "3.");
+}
+
+// writes Count bytes as the body of an array initializer
+static void WriteBytes(const uint8_t *pBytes, int Count)
+{
+  int i;
+
+  for (i = 0; i < Count; i++)
+  {
+    if ((i % BYTES_PER_LINE) == 0)
+    {
+      printf("  ");
+    }
+    printf("0x%02x,", pBytes[i]);
+    if (((i % BYTES_PER_LINE) == (BYTES_PER_LINE - 1)) || (i == Count - 1))
+    {
+      printf("\n");
+    }
+    else
+    {
+      printf(" ");
+    }
+  }
+}
+
+static void WriteImage(const Image_t *pImage)
+{
+  printf("\n// %s\n", pImage->pComment);
+  printf("const uint8_t %s[SCREEN_IMAGE_SIZE] = {\n", pImage->pName);
+  WriteBytes(u8g2_GetBufferPtr(&u8g2), IMAGE_BYTES);
+  printf("};\n");
+}
+
+// writes the pages Page0 to Page0 + Pages - 1, columns x to x + w - 1 of
+// pImage as a sprite bitmap
+static void WriteSpriteBitmap(const char *pName, uint8_t Input,
+    const uint8_t *pImage, int x, int Page0, int w, int Pages)
+{
+  int Page;
+
+  printf("static const uint8_t %s%u[] = {\n", pName, Input);
+  for (Page = Page0; Page < Page0 + Pages; Page++)
+  {
+    WriteBytes(pImage + Page * 128 + x, w);
+  }
+  printf("};\n");
+}
+
+// finds the columns and pages that change when the arrows for each input
+// are highlighted and writes them out, normal and highlighted, followed by
+// the sprite table
+static void WriteArrowSprites(void)
+{
+  const uint8_t *pBuf = u8g2_GetBufferPtr(&u8g2);
+  int x0[NUM_INPUTS], Page0[NUM_INPUTS], w[NUM_INPUTS], Pages[NUM_INPUTS];
+  int MinX, MaxX, MinPage, MaxPage;
+  int i;
+  int Input;
+
+  u8g2_ClearBuffer(&u8g2);
+  DrawArrows();
+  memcpy(Normal, pBuf, IMAGE_BYTES);
+
+  printf("\n// arrow sprites, as in ArrowsImage and highlighted\n");
+  for (Input = 0; Input < NUM_INPUTS; Input++)
+  {
+    u8g2_ClearBuffer(&u8g2);
+    DrawHighlighted(Input);
+    MinX = 128;
+    MaxX = -1;
+    MinPage = 8;
+    MaxPage = -1;
+    for (i = 0; i < IMAGE_BYTES; i++)
+    {
+      if (pBuf[i] != Normal[i])
+      {
+        MinX = (i % 128) < MinX ? (i % 128) : MinX;
+        MaxX = (i % 128) > MaxX ? (i % 128) : MaxX;
+        MinPage = (i / 128) < MinPage ? (i / 128) : MinPage;
+        MaxPage = (i / 128) > MaxPage ? (i / 128) : MaxPage;
+      }
+    }
+    w[Input] = 0;
+    if (MaxX >= 0)
+    {
+      x0[Input] = MinX;
+      Page0[Input] = MinPage;
+      w[Input] = MaxX - MinX + 1;
+      Pages[Input] = MaxPage - MinPage + 1;
+      WriteSpriteBitmap("ArrowNormal", Input, Normal, MinX, MinPage,
+          w[Input], Pages[Input]);
+      WriteSpriteBitmap("ArrowInverted", Input, pBuf, MinX, MinPage,
+          w[Input], Pages[Input]);
+    }
+  }
+
+  printf("\nconst Sprite_t ArrowSprites[NUM_ARROW_SPRITES] = {\n");
+  for (Input = 0; Input < NUM_INPUTS; Input++)
+  {
+    if (w[Input] != 0)
+    {
+      printf("  { %d, %d, %d, %d, ArrowNormal%d, ArrowInverted%d },\n",
+          x0[Input], Page0[Input], w[Input], Pages[Input], Input, Input);
+    }
+    else
+    {
+      printf("  { 0, 0, 0, 0, NULL, NULL },\n");
+    }
+  }
+  printf("};\n");
+}
+
+// renders the digits side by side, each in a cell as wide as its advance
+// and as high as the tallest digit, and writes the atlas for them
+static void WriteDigitAtlas(void)
+{
+  const uint8_t *pBuf = u8g2_GetBufferPtr(&u8g2);
+  char Digit[2] = "0";
+  int Advance = u8g2_GetStrWidth(&u8g2, "0");
+  int Baseline = 32;
+  int Top = 64;
+  int Bottom = -1;
+  int Height;
+  int Page;
+  int x;
+  int Row;
+
+  u8g2_ClearBuffer(&u8g2);
+  for (Digit[0] = '0'; Digit[0] <= '9'; Digit[0]++)
+  {
+    if (u8g2_GetStrWidth(&u8g2, Digit) != Advance)
+    {
+      fprintf(stderr, "'%s' is not %d pixels wide\n", Digit, Advance);
+    }
+    DrawText((Digit[0] - '0') * Advance, Baseline, Digit);
+  }
+  for (x = 0; x < ATLAS_CELLS * Advance; x++)
+  {
+    for (Row = 0; Row < 64; Row++)
+    {
+      if (pBuf[(Row / 8) * 128 + x] & (1 << (Row % 8)))
+      {
+        Top = Row < Top ? Row : Top;
+        Bottom = Row > Bottom ? Row : Bottom;
+      }
+    }
+  }
+  Height = Bottom - Top + 1;
+
+  // draw them again with the top row of the cells on page 0
+  u8g2_ClearBuffer(&u8g2);
+  for (Digit[0] = '0'; Digit[0] <= '9'; Digit[0]++)
+  {
+    DrawText((Digit[0] - '0') * Advance, Baseline - Top, Digit);
+  }
+  printf("\n// digits 0 to 9 and a blank, %d x %d cells\n", Advance, Height);
+  printf("static const uint8_t DigitAtlasBitmap[] = {\n");
+  for (Page = 0; Page < (Height + 7) / 8; Page++)
+  {
+    WriteBytes(pBuf + Page * 128, ATLAS_CELLS * Advance);
+  }
+  printf("};\n");
+  printf("\nconst u8g2_digit_atlas_t DigitAtlas = { %d, %d, %d, "
+      "DigitAtlasBitmap };\n", Advance, Height, Baseline - Top);
+}
+
+int main(void)
+{
+  unsigned i;
+
+  // same setup as InitDisplay
+  u8g2_Setup_ssd1306_128x64_noname_f(&u8g2, U8G2_R0, NullByte, NullGpio);
+#ifdef U8G2_WITH_FONT_INDEX
+  u8g2_SetFontIndexBuffer(&u8g2, FontIndex,
+      sizeof(FontIndex) / sizeof(FontIndex[0]));
+#endif
+  u8g2_SetFont(&u8g2, u8g2_font_t0_18_game);
+  u8g2_SetFontMode(&u8g2, 0);
+  u8g2_SetFontRefHeightAll(&u8g2);
+
+  printf("/*************************************************************"
+      "***************\n");
+  printf(" Module\n   ScreenImages.c\n\n");
+  printf(" Description\n");
+  printf("   Static screen backgrounds in SSD1306 page format, see"
+      " ScreenImages.h\n\n");
+  printf(" Notes\n");
+  printf("   Generated by Tools/ScreenGen, do not edit\n");
+  printf("**************************************************************"
+      "**************/\n");
+  printf("#include <stddef.h>\n");
+  printf("#include \"ScreenImages.h\"\n");
+  for (i = 0; i < sizeof(Images) / sizeof(Images[0]); i++)
+  {
+    u8g2_ClearBuffer(&u8g2);
+    Images[i].Draw();
+    WriteImage(&Images[i]);
+  }
+  WriteArrowSprites();
+  WriteDigitAtlas();
+  printf("/*------------------------------ End of file -----------------"
+      "-------------*/\n");
+  return 0;
+}
@@ -0,0 +1,133 @@
+/****************************************************************************
+ Module
+   TraceDecode.c
+
+ Revision
+   1.0.0
+
+ Description
+   Host tool that turns a raw terminal capture from a build with
+   _INCLUDE_TRACE_ into readable text. Binary ES_Trace records are printed
+   with their time stamp and the text from TraceIds.h, everything else
+   (printf output) is passed through as is.
+
+ Notes
+   Build from this directory with any C99 compiler:
+
+     cc -std=c99 -I../../FrameworkHeaders -I../../ProjectHeaders \
+        TraceDecode.c -o TraceDecode
+
+   and run it on a capture file, or on - to read stdin:
+
+     ./TraceDecode capture.bin
+
+   Time stamps are the 20MHz core timer, shown in microseconds since the
+   first record.
+
+ History
+ When           Who     What/Why
+ -------------- ---     --------
+ 11/15/20 14:20 kcao    started coding
+****************************************************************************/
+/*----------------------------- Include Files -----------------------------*/
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "TraceIds.h"
+
+/*----------------------------- Module Defines ----------------------------*/
+// must match ES_Trace.h, which pulls in device headers so is not included
+#define ES_TRACE_SYNC 0xA5
+#define RECORD_BYTES 12
+#define CORE_TICKS_PER_US 20
+
+/*---------------------------- Module Variables ---------------------------*/
+static const char *const Formats[] = {
+#define TRACE_ID(Name, Format) Format,
+  TRACE_ID_LIST
+#undef TRACE_ID
+};
+
+/*------------------------------ Module Code ------------------------------*/
+static uint16_t GetWord(const uint8_t *pBytes)
+{
+  return pBytes[0] | (pBytes[1] << 8);
+}
+
+// true if the 12 bytes at pBytes form a valid record
+static int IsRecord(const uint8_t *pBytes)
+{
+  uint16_t Check;
+
+  if ((pBytes[0] != ES_TRACE_SYNC) || (pBytes[1] >= NUM_TRACE_IDS))
+  {
+    return 0;
+  }
+  Check = pBytes[1] ^ GetWord(&pBytes[2]) ^ GetWord(&pBytes[4]) ^
+      GetWord(&pBytes[8]) ^ GetWord(&pBytes[10]);
+  return Check == GetWord(&pBytes[6]);
+}
+
+int main(int argc, char *argv[])
+{
+  FILE *pFile;
+  uint8_t Window[RECORD_BYTES];
+  size_t Fill = 0;
+  int c;
+  int HaveFirst = 0;
+  uint32_t Last = 0;
+  uint64_t Elapsed = 0;
+  unsigned long Records = 0;
+
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s capture|-\n", argv[0]);
+    return 2;
+  }
+  pFile = (strcmp(argv[1], "-") == 0) ? stdin : fopen(argv[1], "rb");
+  if (pFile == NULL)
+  {
+    perror(argv[1]);
+    return 2;
+  }
+
+  for (;;)
+  {
+    // keep a window of RECORD_BYTES, shifting out text a byte at a time
+    while ((Fill < RECORD_BYTES) && ((c = fgetc(pFile)) != EOF))
+    {
+      Window[Fill++] = (uint8_t)c;
+    }
+    if (Fill == 0)
+    {
+      break;
+    }
+    if ((Fill == RECORD_BYTES) && IsRecord(Window))
+    {
+      uint32_t Stamp = GetWord(&Window[8]) | ((uint32_t)GetWord(&Window[10]) << 16);
+      if (!HaveFirst)
+      {
+        HaveFirst = 1;
+        Last = Stamp;
+      }
+      Elapsed += (uint32_t)(Stamp - Last);   // survives the 32 bit wrap
+      Last = Stamp;
+      printf("[%10.1f us] ", (double)Elapsed / CORE_TICKS_PER_US);
+      printf(Formats[Window[1]], GetWord(&Window[2]), GetWord(&Window[4]));
+      printf("\n");
+      Records++;
+      Fill = 0;
+    }
+    else
+    {
+      if (Window[0] != '\r')
+      {
+        putchar(Window[0]);
+      }
+      memmove(Window, &Window[1], --Fill);
+    }
+  }
+  fprintf(stderr, "%lu trace records\n", Records);
+  return 0;
+}
@@ -1,5 +1,17 @@
+#include <string.h>
 #include "../u8g2Headers/spi_master.h"
- //tweaked for PIC32MX170F256B, uses SPI1
+#include "../ProjectHeaders/SPIBus.h"
+ //tweaked for PIC32MX170F256B, uses SPI1 through the SPIBus manager
+
+#define OLED_CS_PIN 1   //hal pin number of RA0
+#define OLED_DC_PIN 19  //hal pin number of RB13
+
+//8 bit words, clock idle high with data out on the falling edge, 10MHz,
+//SDO on RA1
+static const SPIBus_Device_t OLED = {8, 3, 0, OLED_CS_PIN, OLED_DC_PIN, &RPA1R};
+
+//used by SPI_TxBuffer for the bytes that are sent straight away
+static SPIBus_Transaction_t Immediate;
          
 /****************************************************************************
  Function
@@ -9,67 +21,23 @@
  Returns
     void
  Description
-    set up the SPI system for use. Set the clock phase and polarity, master mode
-    clock source, baud rate, SS control, transfer width (8-bits)
+    set up the OLED's own pins (DC on RB13, Reset on RB12) and the shared
+    SPI bus
  Notes
-    don't forget to map the pins & set up the TRIS not only for the SPI pins
-    but also for the DC (RB13) & Reset (RB12) pins 
+    SPIBus sets up SS (RA0), SDO (RA1) and SCK (RB14) and programs SPI1 for
+    the OLED each time it gets the bus
  
 ****************************************************************************/
 void SPI_Init(void){
-    uint8_t clearbuff;
-    
-    //disable analog function on all SPI pins
-    ANSELAbits.ANSA0 = 0;   //RA0
-    ANSELAbits.ANSA1 = 0;   //RA1
+    //disable analog function on the OLED control pins
     ANSELBbits.ANSB12 = 0;  //RB12
     ANSELBbits.ANSB13 = 0;  //RB13
-    ANSELBbits.ANSB14 = 0;  //RB14
     
-    //set RA0 to output and SS*
-    TRISAbits.TRISA0 = 0;
-    RPA0R = 0b0011;
-    
-    //set RA1 to output and SDO
-    TRISAbits.TRISA1 = 0;
-    RPA1R = 0b0011;
-    
-    //set RB12, RB13, RB14 to output
+    //set RB12, RB13 to output
     TRISBbits.TRISB12 = 0; //reset line
     TRISBbits.TRISB13 = 0; //data command line
-    TRISBbits.TRISB14 = 0; //clock line
-    
-    //stop and reset SPI module by clearing the ON bit
-    SPI1CONbits.ON = 0;
-    
-    //clear the receive buffer
-    clearbuff = SPI1BUF;
     
-    //turn off enhanced buffer mode
-    SPI1CONbits.ENHBUF = 0;
-
-    //write the baud rate register (999 when validating and 0 when done)
-    //SPI1BRG = 999;
-    SPI1BRG = 0;
-
-    //clear the SPIROV bit
-    SPI1STATbits.SPIROV = 0;
-    
-    //write desired settings
-    SPI1CONbits.MODE32 = 0; //turn on 8 bit transfer mode
-    SPI1CONbits.MODE16 = 0; //turn on 8 bit transfer mode
-    SPI1CONbits.CKE = 0; //set 2nd clock edge as active
-    SPI1CONbits.CKP = 1; //set clock idle high
-    SPI1CONbits.MSTEN = 1; //enable master mode
-    SPI1CONbits.MSSEN = 1; //slave select enabled
-    SPI1CONbits.MCLKSEL = 0; //set MCLK as peripheral bus CLK
-    SPI1CONbits.SMP = 0; //input data sampled at middle of data output time
-    SPI1CONbits.FRMPOL = 0; //frame pulse or SS pin is active low
-    SPI1CONbits.FRMEN = 0; //framed SPI support is disabled
-    SPI1CONbits.DISSDI = 0; //SDI pin controlled by SPI module
-    
-    //enable SPI operation by setting th ON bit
-    SPI1CONbits.ON = 1;   
+    SPIBus_Init();
 }
 /****************************************************************************
  Function
@@ -79,21 +47,12 @@ void SPI_Init(void){
  Returns
     void
  Description
-    write the data to the SPIxBUF and then wait for it to go out (SPITBF)
+    send one byte and wait for it to go out
  Notes
-    don't forget to read the buffer after the transfer to prevent over-runs
  
 ****************************************************************************/
 void SPI_Tx(uint8_t data){
-   bool buffer_full;
-   buffer_full = SPI1STATbits.SPITBF;
-   while (buffer_full){
-      buffer_full = SPI1STATbits.SPITBF;
-   }
-   SPI1BUF = data;
-   // Read buffer to prevent overruns
-   uint8_t clear_var;
-   clear_var = SPI1BUF;
+    SPI_TxBuffer(&data, 1);
 }
 
 /****************************************************************************
@@ -105,170 +64,193 @@ void SPI_Tx(uint8_t data){
  Returns
     void
  Description
-   loop through buffer calling SPI_Tx for each element in the buffer
+   queue the buffer on the bus with the current DC level and wait until it
+   is out
  Notes
-
+   only for the u8g2 setup and other short transfers, screen updates go
+   through SPI_QueueBegin/SPI_QueueStart
  
 ****************************************************************************/
 void SPI_TxBuffer(uint8_t *buffer, uint8_t length){
-   uint8_t i;
-   for (i = 0; i < length; i++){
-      SPI_Tx(buffer[i]);
-   }
+    Immediate.pDevice = &OLED;
+    Immediate.pTx = buffer;
+    Immediate.Count = length;
+    Immediate.Dc = DC_PIN;
+    Immediate.Done = NULL;
+    SPIBus_Submit(&Immediate);
+    while (Immediate.State != SPIBusFree){
+    }
 }
 
+/*---------------------------- Queued transfers -----------------------------*/
+// A screen update is a list of segments, each a run of bytes sent with one DC
+// level, queued on the bus as one transaction per segment. Command bytes are
+// copied into CmdStore, data bytes are sent straight from where they are (the
+// u8g2 tile buffer), so they must not change until the update is done.
+#define MAX_SEGMENTS    128     // a full frame of 8 rows x 8 runs x (cmd+data)
+#define CMD_STORE_SIZE  256
+
+static SPIBus_Transaction_t Segments[MAX_SEGMENTS];
+static uint8_t CmdStore[CMD_STORE_SIZE];
+static uint16_t NumSegments;
+static uint16_t CmdUsed;
+static uint8_t QueueDC;
+static bool Queueing = false;
+
+static void SendQueueBlocking(void);
+
 /****************************************************************************
  Function
-    SPI_Write
+    SPI_QueueBegin
  Parameters
-   uint32_t value
+    void
  Returns
-    bool
+    void
  Description
-    write to SPI buffer
+    from now on SPI_QueueBytes collects segments instead of sending them
  Notes
+    waits for the last update to finish, its segments are reused
 ****************************************************************************/
-bool SPI_Write(uint32_t value){
-    bool returnVal = false;
-    uint8_t bitWidth;
-    
-    //check what bitWidth is
-    if (SPI1CONbits.MODE32 == 1){
-        bitWidth = 32;
+void SPI_QueueBegin(void){
+    while (SPI_IsQueueBusy()){
     }
-    else if (SPI1CONbits.MODE16 == 1){
-        bitWidth = 16;
-    }
-    else if (SPI1CONbits.MODE32 == 0 & SPI1CONbits.MODE16 == 0){
-        bitWidth = 8;
-    }
-    
-    //check that transmit buffer is not full
-    if(!SPI1STATbits.SPITBF){
-        //split up value based on bitWidth and write to SPI
-        if (bitWidth == 32){
-            SPI1BUF = value; //write to SPI
-            returnVal = true; //write is successful!
-        }
-        else if (bitWidth == 16){
-            //create two variables to store 16 bit words
-            uint16_t value1;
-            uint16_t value2;
-
-            //set variables to each 16 bit segment
-            value1 = value & 0x00FF;
-            value2 = value >> 16;
-
-            //write to SPI
-            SPI1BUF = value1;
-            SPI1BUF = value2;
-
-            returnVal = true; //write is successful!
-        }
-        else if (bitWidth == 8){
-            //create four variables to store 8 bit words
-            uint8_t value1;
-            uint8_t value2;
-            uint8_t value3;
-            uint8_t value4;
-
-            //set variables to each 8 bit segment
-            value1 = value & 0x00FF;
-            value2 = value >> 8;
-            value3 = value >> 16;
-            value4 = value >> 24;
+    NumSegments = 0;
+    CmdUsed = 0;
+    Queueing = true;
+}
 
-            //write to SPI
-            SPI1BUF = value1;
-            SPI1BUF = value2;
-            SPI1BUF = value3;
-            SPI1BUF = value4;
+/****************************************************************************
+ Function
+    SPI_IsQueueing
+ Parameters
+    void
+ Returns
+    bool, true between SPI_QueueBegin and SPI_QueueStart
+****************************************************************************/
+bool SPI_IsQueueing(void){
+    return Queueing;
+}
 
-            returnVal = true; //write is successful!
-        } 
-    }
-    else {
-        //transmit buffer must be full
-        returnVal = false;
-    }
-    return returnVal;
+/****************************************************************************
+ Function
+    SPI_QueueSetDC
+ Parameters
+   uint8_t dc   DC level for the bytes queued after this call
+ Returns
+    void
+****************************************************************************/
+void SPI_QueueSetDC(uint8_t dc){
+    QueueDC = dc;
 }
 
 /****************************************************************************
  Function
-    SPI_HasTransferCompleted
+    SPI_QueueBytes
  Parameters
-    none
+   uint8_t *buffer, the bytes to send
+   uint8_t length   the number of bytes
  Returns
-    bool
+    void
  Description
-    check if transfer finished
+    adds the bytes to the update with the current DC level. Commands (DC
+    low) are copied and merged with the command segment before them, data is
+    referenced in place and merged with the data segment before it if it
+    follows on in memory
  Notes
+    if the segment list fills up, what is queued so far is sent and waited
+    for
 ****************************************************************************/
-bool SPI_HasTransferCompleted(){
-    static uint8_t lastRegState = 0; //set to full
-    uint8_t currentRegState;
-    bool transferComplete;
+void SPI_QueueBytes(uint8_t *buffer, uint8_t length){
+    SPIBus_Transaction_t *pLast;
     
-    //set currentState to shift register state
-    currentRegState = SPI1STATbits.SRMT;
-    if ((lastRegState != currentRegState) && (currentRegState == 1)){
-        //the shift register must have become empty
-        transferComplete = true;
+    if ((NumSegments == MAX_SEGMENTS) || 
+            ((QueueDC == 0) && ((CmdUsed + length) > CMD_STORE_SIZE))){
+        SendQueueBlocking();
+    }
+    
+    if (QueueDC == 0){
+        memcpy(&CmdStore[CmdUsed], buffer, length);
+        //commands sent back to back go out as one segment
+        if (NumSegments != 0){
+            pLast = &Segments[NumSegments - 1];
+            if ((pLast->Dc == 0) && 
+                    (((const uint8_t *)pLast->pTx + pLast->Count) == 
+                    &CmdStore[CmdUsed])){
+                pLast->Count += length;
+                CmdUsed += length;
+                return;
+            }
+        }
+        Segments[NumSegments].pTx = &CmdStore[CmdUsed];
+        CmdUsed += length;
     }
     else {
-        //the shift register must not be empty
-        transferComplete = false;
+        //data that carries on where the last data segment ends (the rows
+        //of a display window) goes out as one segment as well
+        if (NumSegments != 0){
+            pLast = &Segments[NumSegments - 1];
+            if ((pLast->Dc == 1) && 
+                    (((const uint8_t *)pLast->pTx + pLast->Count) == buffer)){
+                pLast->Count += length;
+                return;
+            }
+        }
+        Segments[NumSegments].pTx = buffer;
     }
-    //set last state equal to current state
-    lastRegState = currentRegState;
-    return transferComplete;
+    Segments[NumSegments].pDevice = &OLED;
+    Segments[NumSegments].Count = length;
+    Segments[NumSegments].Dc = QueueDC;
+    Segments[NumSegments].Done = NULL;
+    NumSegments++;
 }
 
 /****************************************************************************
  Function
-    SPI_HasXmitBufferSpaceOpened
+    SPI_QueueStart
  Parameters
-    none
+   void (*Done)(void)   called from the SPI interrupt once the last byte is
+                        out, or right away if nothing was queued
  Returns
-    bool
+    void
  Description
-    check if a space in buffer is empty
- Notes
+    stops queueing and hands the segments to the bus
 ****************************************************************************/
-bool SPI_HasXmitBufferSpaceOpened(){
-    static uint8_t lastBufferState = 1; //set to full
-    uint8_t currentBufferState;
-    bool spaceOpen;
+void SPI_QueueStart(void (*Done)(void)){
+    uint16_t i;
     
-    //set current state to transmit buffer state
-    currentBufferState = SPI1STATbits.SPITBF;
-    if ((lastBufferState != currentBufferState) && (currentBufferState == 0)){
-        //transmit buffer space must not be full
-        spaceOpen = true;
+    Queueing = false;
+    if (NumSegments == 0){
+        Done();
+        return;
     }
-    else {
-        //transmit buffer space must be full
-        spaceOpen = false;
+    Segments[NumSegments - 1].Done = Done;
+    for (i = 0; i < NumSegments; i++){
+        SPIBus_Submit(&Segments[i]);
     }
-    //set last state equal to current state
-    lastBufferState = currentBufferState;
-    return spaceOpen;
 }
 
 /****************************************************************************
  Function
-    SPI_GetNumOpenXmitSpaces
+    SPI_IsQueueBusy
  Parameters
-    none
+    void
  Returns
-    uint8_t 
- Description
-    checks how many open spaces there are in the buffer
- Notes
+    bool, true while an update is still on the bus
 ****************************************************************************/
-uint8_t SPI_GetNumOpenXmitSpaces(){
-    uint8_t numSpaces;
-    numSpaces = 4 - SPI1STATbits.TXBUFELM;
-    return numSpaces;
+bool SPI_IsQueueBusy(void){
+    return (NumSegments != 0) && 
+            (Segments[NumSegments - 1].State != SPIBusFree);
+}
+
+//sends the segments queued so far, waits for them and empties the list
+static void SendQueueBlocking(void){
+    uint16_t i;
+    
+    for (i = 0; i < NumSegments; i++){
+        SPIBus_Submit(&Segments[i]);
+    }
+    while (SPI_IsQueueBusy()){
+    }
+    NumSegments = 0;
+    CmdUsed = 0;
 }
@@ -34,12 +34,242 @@
 */
 
 #include "../u8g2Headers/u8g2.h"
+#include <string.h>
 
 
 void u8g2_SetBitmapMode(u8g2_t *u8g2, uint8_t is_transparent) {
   u8g2->bitmap_transparency = is_transparent;
 }
 
+/*===============================================*/
+/* page blit for u8g2_ll_hvline_vertical_top_lsb buffers */
+
+/*
+  Description:
+    Check whether u8g2_PageBlit() can write into the buffer: page layout
+    of u8g2_ll_hvline_vertical_top_lsb, no display rotation and a visible
+    clip window.
+*/
+uint8_t u8g2_IsPageBlitBuffer(u8g2_t *u8g2)
+{
+  if ( u8g2->cb != U8G2_R0 || u8g2->ll_hvline != u8g2_ll_hvline_vertical_top_lsb )
+    return 0;
+#ifdef U8G2_WITH_CLIP_WINDOW_SUPPORT
+  if ( u8g2->is_page_clip_window_intersection == 0 )
+    return 0;
+#endif /* U8G2_WITH_CLIP_WINDOW_SUPPORT */
+  return 1;
+}
+
+/*
+  Description:
+    Check whether a box is completely inside the current buffer and clip
+    window, so that it can be drawn without clipping.
+*/
+uint8_t u8g2_IsPageBlitBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  if ( x < u8g2->user_x0 || (uint16_t)x + w > u8g2->user_x1 )
+    return 0;
+  if ( y < u8g2->user_y0 || (uint16_t)y + h > u8g2->user_y1 )
+    return 0;
+  return 1;
+}
+
+/*
+  Description:
+    Combine one column byte with the buffer.
+    fg:		pixels set in the source
+    box:	pixels covered by the source
+*/
+static void u8g2_blit_byte(uint8_t *dest, uint8_t fg, uint8_t box, uint8_t color, uint8_t is_transparent)
+{
+  if ( is_transparent == 0 )
+  {
+    /* the background color is the inverse of 0 and 1, and 0 for xor */
+    if ( color == 0 )
+      *dest |= box & ~fg;
+    else
+      *dest &= ~(box & ~fg);
+  }
+  if ( color == 0 )
+    *dest &= ~fg;
+  else if ( color == 1 )
+    *dest |= fg;
+  else
+    *dest ^= fg;
+}
+
+/*
+  Description:
+    Copy an image in page format into the buffer. The image has
+    (h+7)/8 pages of w column bytes, bit 0 is the upper pixel of a column
+    byte. Column byte c of page p is at src[p*page_step + c*col_step], so
+    both page major images (col_step 1, page_step w, same as the display
+    buffer) and column major images (col_step (h+7)/8, page_step 1) can be
+    used. Source bits beyond h are ignored.
+    If y is a multiple of 8, bytes are copied, otherwise each buffer byte
+    is merged from two source bytes.
+  Args:
+    color:		draw color for the set pixels (0, 1 or 2 for xor)
+    is_transparent:	0: the unset pixels are drawn in the background color
+  Assumptions:
+    u8g2_IsPageBlitBuffer() and u8g2_IsPageBlitBox() have returned 1
+*/
+void u8g2_PageBlit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *src, uint8_t col_step, uint16_t page_step, uint8_t color, uint8_t is_transparent)
+{
+  uint8_t *dest;
+  const uint8_t *s;
+  uint8_t pages, page;
+  uint8_t shift;
+  uint8_t box, prev_box;	/* rows covered by the source page and the page before */
+  uint8_t mbox;		/* rows covered in the buffer page */
+  uint8_t lo, hi;
+  u8g2_uint_t c;
+  
+  if ( w == 0 || h == 0 )
+    return;
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_MarkDirtyBox(u8g2, x, y, w, h);
+#endif /* U8G2_WITH_DIRTY_TILES */
+  
+  y -= u8g2->pixel_curr_row;
+  shift = y & 7;
+  pages = (h + 7) >> 3;
+  dest = u8g2->tile_buf_ptr;
+  dest += (uint16_t)(y >> 3) * u8g2->pixel_buf_width;
+  dest += x;
+  
+  prev_box = 0;
+  for( page = 0; page <= pages; page++ )
+  {
+    /* rows of the source page */
+    box = 0;
+    if ( page < pages )
+    {
+      box = 0x0ff;
+      if ( h < 8 )
+	box >>= 8 - h;
+      h -= h < 8 ? h : 8;
+    }
+    mbox = (box << shift) | (prev_box >> (8 - shift));
+    if ( mbox != 0 )
+    {
+      s = src + page * page_step;
+      if ( shift == 0 && mbox == 0x0ff && color == 1 && is_transparent == 0 && col_step == 1 )
+      {
+	/* the source is the new content of the buffer */
+	memcpy(dest, s, w);
+      }
+      else
+      {
+	for( c = 0; c < w; c++ )
+	{
+	  lo = 0;
+	  hi = 0;
+	  if ( page < pages )
+	    lo = s[c*col_step] & box;
+	  if ( page > 0 )
+	    hi = s[c*col_step - page_step] & prev_box;
+	  u8g2_blit_byte(dest + c, (lo << shift) | (hi >> (8 - shift)), mbox, color, is_transparent);
+	}
+      }
+    }
+    prev_box = box;
+    dest += u8g2->pixel_buf_width;
+  }
+}
+
+#ifdef U8G2_WITH_PAGE_BLIT
+/*
+  Description:
+    Fast path for the row based bitmap formats. Collects 8 rows of the bitmap
+    into column bytes and writes them with u8g2_PageBlit().
+  Args:
+    row_len:	bytes per bitmap row
+    is_msb:	1: bit 7 is the left pixel (u8g2_DrawBitmap), 0: bit 0 (XBM)
+  Return:
+    0 if the bitmap must be drawn pixel by pixel
+*/
+static uint8_t u8g2_blit_rows(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap, u8g2_uint_t row_len, uint8_t is_msb)
+{
+  uint8_t strip[256];
+  u8g2_uint_t c;
+  uint8_t r, rows;
+  uint8_t bit;
+  uint8_t b;
+  
+  if ( u8g2_IsPageBlitBuffer(u8g2) == 0 || u8g2_IsPageBlitBox(u8g2, x, y, w, h) == 0 )
+    return 0;
+  
+  while( h > 0 )
+  {
+    rows = h < 8 ? h : 8;
+    for( c = 0; c < w; c++ )
+      strip[c] = 0;
+    for( r = 0; r < rows; r++ )
+    {
+      bit = 1 << r;
+      for( c = 0; c < w; c++ )
+      {
+	b = u8x8_pgm_read(bitmap + (c >> 3));
+	if ( is_msb ? (b & (0x80 >> (c & 7))) : (b & (1 << (c & 7))) )
+	  strip[c] |= bit;
+      }
+      bitmap += row_len;
+    }
+    u8g2_PageBlit(u8g2, x, y, w, rows, strip, 1, w, u8g2->draw_color, u8g2->bitmap_transparency);
+    y += rows;
+    h -= rows;
+  }
+  return 1;
+}
+#endif /* U8G2_WITH_PAGE_BLIT */
+
+/*
+  x,y		Position on the display
+  w, h		Size of the bitmap in pixel
+  bitmap	(h+7)/8 pages of w bytes, bit 0 is the upper pixel of a column
+  		byte: the layout of the SSD13xx display memory and the u8g2
+  		full buffer.
+  Set pixels are drawn with the draw color, unset pixels with the inverse
+  color unless the bitmap mode is transparent.
+*/
+void u8g2_DrawPageBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  uint8_t color = u8g2->draw_color;
+  uint8_t ncolor = (color == 0 ? 1 : 0);
+  u8g2_uint_t c, r;
+  
+#ifdef U8G2_WITH_INTERSECTION
+  if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
+    return;
+#endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_PAGE_BLIT
+  if ( u8g2_IsPageBlitBuffer(u8g2) && u8g2_IsPageBlitBox(u8g2, x, y, w, h) )
+  {
+    u8g2_PageBlit(u8g2, x, y, w, h, bitmap, 1, w, color, u8g2->bitmap_transparency);
+    return;
+  }
+#endif /* U8G2_WITH_PAGE_BLIT */
+  
+  for( r = 0; r < h; r++ )
+  {
+    for( c = 0; c < w; c++ )
+    {
+      if ( u8x8_pgm_read(bitmap + (r >> 3) * w + c) & (1 << (r & 7)) ) {
+	u8g2->draw_color = color;
+	u8g2_DrawHVLine(u8g2, x+c, y+r, 1, 0);
+      } else if ( u8g2->bitmap_transparency == 0 ) {
+	u8g2->draw_color = ncolor;
+	u8g2_DrawHVLine(u8g2, x+c, y+r, 1, 0);
+      }
+    }
+  }
+  u8g2->draw_color = color;
+}
+
 /*
   x,y 	Position on the display
   len		Length of bitmap line in pixel. Note: This differs from u8glib which had a bytecount here.
@@ -57,6 +287,11 @@ void u8g2_DrawHorizontalBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_
   if ( u8g2_IsIntersection(u8g2, x, y, x+len, y+1) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_PAGE_BLIT
+  if ( u8g2_blit_rows(u8g2, x, y, len, 1, b, 0, 1) )
+    return;
+#endif /* U8G2_WITH_PAGE_BLIT */
   
   mask = 128;
   while(len > 0)
@@ -92,6 +327,11 @@ void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_PAGE_BLIT
+  if ( u8g2_blit_rows(u8g2, x, y, w, h, bitmap, cnt, 1) )
+    return;
+#endif /* U8G2_WITH_PAGE_BLIT */
   
   while( h > 0 )
   {
@@ -113,6 +353,11 @@ void u8g2_DrawHXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len,
   if ( u8g2_IsIntersection(u8g2, x, y, x+len, y+1) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_PAGE_BLIT
+  if ( u8g2_blit_rows(u8g2, x, y, len, 1, b, 0, 0) )
+    return;
+#endif /* U8G2_WITH_PAGE_BLIT */
   
   mask = 1;
   while(len > 0) {
@@ -146,6 +391,11 @@ void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_PAGE_BLIT
+  if ( u8g2_blit_rows(u8g2, x, y, w, h, bitmap, blen, 0) )
+    return;
+#endif /* U8G2_WITH_PAGE_BLIT */
   
   while( h > 0 )
   {
@@ -170,6 +420,11 @@ void u8g2_DrawHXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len,
   if ( u8g2_IsIntersection(u8g2, x, y, x+len, y+1) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_PAGE_BLIT
+  if ( u8g2_blit_rows(u8g2, x, y, len, 1, b, 0, 0) )
+    return;
+#endif /* U8G2_WITH_PAGE_BLIT */
   
   mask = 1;
   while(len > 0)
@@ -205,6 +460,11 @@ void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+
+#ifdef U8G2_WITH_PAGE_BLIT
+  if ( u8g2_blit_rows(u8g2, x, y, w, h, bitmap, blen, 0) )
+    return;
+#endif /* U8G2_WITH_PAGE_BLIT */
   
   while( h > 0 )
   {
@@ -215,4 +475,63 @@ void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8
   }
 }
 
+/*
+  Description:
+    Draw a number from a prerendered digit atlas, right aligned in "cnt"
+    cells (1..5). Leading cells get the blank cell of the atlas, digits
+    which do not fit are dropped from the left. The number is converted by
+    u8x8_u16toar(), and each cell is copied from the atlas like a page
+    bitmap: there is no format to parse and no glyph to decode.
+  Args:
+    x, y:	left end of the first cell and the baseline, as for u8g2_DrawStr()
+    atlas:	cell size and bitmap, usually generated from a monospaced font
+    v:		the number
+  Set pixels are drawn with the draw color, unset pixels with the inverse
+  color unless the bitmap mode is transparent.
+*/
+void u8g2_DrawDigits(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const u8g2_digit_atlas_t *atlas, uint16_t v, uint8_t cnt)
+{
+  char digits[6];
+  const uint8_t *cell;
+  uint8_t color = u8g2->draw_color;
+  uint8_t ncolor = (color == 0 ? 1 : 0);
+  uint16_t page_step = (uint16_t)atlas->w * 11;
+  u8g2_uint_t w = atlas->w;
+  u8g2_uint_t h = atlas->h;
+  u8g2_uint_t c, r;
+  uint8_t i;
+  
+  y -= atlas->ascent;
+  u8x8_u16toar(digits, v, cnt);
+  for( i = 0; i < cnt; i++, x += w )
+  {
+    cell = atlas->bitmap + (digits[i] == ' ' ? 10 : digits[i] - '0') * w;
+#ifdef U8G2_WITH_INTERSECTION
+    if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
+      continue;
+#endif /* U8G2_WITH_INTERSECTION */
+#ifdef U8G2_WITH_PAGE_BLIT
+    if ( u8g2_IsPageBlitBuffer(u8g2) && u8g2_IsPageBlitBox(u8g2, x, y, w, h) )
+    {
+      u8g2_PageBlit(u8g2, x, y, w, h, cell, 1, page_step, color, u8g2->bitmap_transparency);
+      continue;
+    }
+#endif /* U8G2_WITH_PAGE_BLIT */
+    for( r = 0; r < h; r++ )
+    {
+      for( c = 0; c < w; c++ )
+      {
+	if ( u8x8_pgm_read(cell + (r >> 3) * page_step + c) & (1 << (r & 7)) ) {
+	  u8g2->draw_color = color;
+	  u8g2_DrawHVLine(u8g2, x+c, y+r, 1, 0);
+	} else if ( u8g2->bitmap_transparency == 0 ) {
+	  u8g2->draw_color = ncolor;
+	  u8g2_DrawHVLine(u8g2, x+c, y+r, 1, 0);
+	}
+      }
+    }
+    u8g2->draw_color = color;
+  }
+}
+
 
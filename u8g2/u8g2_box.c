@@ -35,6 +35,43 @@
 
 #include "../u8g2Headers/u8g2.h"
 
+#ifdef U8G2_WITH_BOX_FILL
+/*
+  Description:
+    Clip a box against the user window and fill it page by page with
+    u8g2_ll_box_vertical_top_lsb().
+  Return:
+    0 if the box has to be drawn line by line: rotated display, other
+    buffer layout, or a box which wraps around the coordinate range (the
+    line clipping has its own rules for those)
+*/
+static uint8_t u8g2_fill_box(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_uint_t x1, y1;
+  
+  if ( u8g2_IsPageBlitBuffer(u8g2) == 0 )
+    return 0;
+  x1 = x;
+  x1 += w;
+  y1 = y;
+  y1 += h;
+  if ( x1 < x || y1 < y )
+    return 0;
+  
+  if ( x < u8g2->user_x0 )
+    x = u8g2->user_x0;
+  if ( x1 > u8g2->user_x1 )
+    x1 = u8g2->user_x1;
+  if ( y < u8g2->user_y0 )
+    y = u8g2->user_y0;
+  if ( y1 > u8g2->user_y1 )
+    y1 = u8g2->user_y1;
+  if ( x < x1 && y < y1 )
+    u8g2_ll_box_vertical_top_lsb(u8g2, x, y - u8g2->pixel_curr_row, x1 - x, y1 - y);
+  return 1;
+}
+#endif /* U8G2_WITH_BOX_FILL */
+
 /*
   draw a filled box
   restriction: does not work for w = 0 or h = 0
@@ -45,6 +82,10 @@ void u8g2_DrawBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g
   if ( u8g2_IsIntersection(u8g2, x, y, x+w, y+h) == 0 ) 
     return;
 #endif /* U8G2_WITH_INTERSECTION */
+#ifdef U8G2_WITH_BOX_FILL
+  if ( u8g2_fill_box(u8g2, x, y, w, h) != 0 )
+    return;
+#endif /* U8G2_WITH_BOX_FILL */
   while( h != 0 )
   { 
     u8g2_DrawHVLine(u8g2, x, y, w, 0);
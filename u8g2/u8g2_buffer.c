@@ -37,15 +37,111 @@
 #include <string.h>
 
 /*============================================*/
+#ifdef U8G2_WITH_DIRTY_TILES
+/* erasing a tile changes it too: mark every tile which is not blank yet */
+static void u8g2_mark_nonblank_tiles(u8g2_t *u8g2)
+{
+  uint8_t *ptr;
+  uint8_t row;
+  uint8_t col;
+  uint8_t i;
+  uint8_t w;
+  
+  w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  ptr = u8g2->tile_buf_ptr;
+  for( row = 0; row < u8g2->tile_buf_height; row++ )
+  {
+    for( col = 0; col < w; col++ )
+    {
+      for( i = 0; i < 8; i++ )
+      {
+	if ( ptr[i] != 0 )
+	{
+	  u8g2->dirty_tiles[row] |= (uint32_t)1 << col;
+	  break;
+	}
+      }
+      ptr += 8;
+    }
+  }
+}
+#endif /* U8G2_WITH_DIRTY_TILES */
+
 void u8g2_ClearBuffer(u8g2_t *u8g2)
 {
   size_t cnt;
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_mark_nonblank_tiles(u8g2);
+#endif /* U8G2_WITH_DIRTY_TILES */
   cnt = u8g2_GetU8x8(u8g2)->display_info->tile_width;
   cnt *= u8g2->tile_buf_height;
   cnt *= 8;
   memset(u8g2->tile_buf_ptr, 0, cnt);
 }
 
+/*
+  Description:
+    Combine a full screen image with the buffer. The image has the layout
+    of a full buffer (u8g2_GetBufferPtr()), so it can be drawn once with
+    u8g2, dumped and kept as a const array in flash. In page mode only the
+    part of the image for the current page is used.
+    Each tile is combined as two 32 bit words. With U8G2_WITH_DIRTY_TILES
+    only tiles which really change are marked, so copying the background
+    which is already there marks nothing.
+  Args:
+    image:	tile_width * tile_height * 8 bytes
+    rop:	U8G2_ROP_COPY, U8G2_ROP_OR, U8G2_ROP_XOR or U8G2_ROP_ANDNOT
+*/
+void u8g2_ComposeBuffer(u8g2_t *u8g2, const uint8_t *image, uint8_t rop)
+{
+  uint8_t *ptr;
+  uint32_t d[2], s[2], n[2];
+  uint8_t row;
+  uint8_t col;
+  uint8_t w;
+  
+  w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  ptr = u8g2->tile_buf_ptr;
+  image += (uint16_t)u8g2->tile_curr_row * w * 8;
+  for( row = 0; row < u8g2->tile_buf_height; row++ )
+  {
+    for( col = 0; col < w; col++ )
+    {
+      /* memcpy, because neither pointer has to be word aligned */
+      memcpy(d, ptr, 8);
+      memcpy(s, image, 8);
+      switch( rop )
+      {
+	case U8G2_ROP_OR:
+	  n[0] = d[0] | s[0];
+	  n[1] = d[1] | s[1];
+	  break;
+	case U8G2_ROP_XOR:
+	  n[0] = d[0] ^ s[0];
+	  n[1] = d[1] ^ s[1];
+	  break;
+	case U8G2_ROP_ANDNOT:
+	  n[0] = d[0] & ~s[0];
+	  n[1] = d[1] & ~s[1];
+	  break;
+	default:
+	  n[0] = s[0];
+	  n[1] = s[1];
+	  break;
+      }
+      if ( n[0] != d[0] || n[1] != d[1] )
+      {
+	memcpy(ptr, n, 8);
+#ifdef U8G2_WITH_DIRTY_TILES
+	u8g2->dirty_tiles[row] |= (uint32_t)1 << col;
+#endif /* U8G2_WITH_DIRTY_TILES */
+      }
+      ptr += 8;
+      image += 8;
+    }
+  }
+}
+
 /*============================================*/
 
 static void u8g2_send_tile_row(u8g2_t *u8g2, uint8_t src_tile_row, uint8_t dest_tile_row)
@@ -61,6 +157,9 @@ static void u8g2_send_tile_row(u8g2_t *u8g2, uint8_t src_tile_row, uint8_t dest_
   offset *= 8;
   ptr += offset;
   u8x8_DrawTile(u8g2_GetU8x8(u8g2), 0, dest_tile_row, w, ptr);
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2->dirty_tiles[src_tile_row] = 0;
+#endif /* U8G2_WITH_DIRTY_TILES */
 }
 
 /* 
@@ -96,6 +195,45 @@ void u8g2_SendBuffer(u8g2_t *u8g2)
   u8x8_RefreshDisplay( u8g2_GetU8x8(u8g2) );  
 }
 
+/*============================================*/
+#ifdef U8G2_WITH_BACK_BUFFER
+/*
+  Description:
+    Give u8g2 a second buffer, as large as the one of the setup procedure
+    (tile_width * tile_buf_height * 8 bytes). Its content does not matter,
+    u8g2_SwapBuffer() overwrites it. NULL removes the back buffer.
+*/
+void u8g2_SetBackBuffer(u8g2_t *u8g2, uint8_t *buf)
+{
+  u8g2->back_buf_ptr = buf;
+}
+
+/*
+  Description:
+    Draw into the other buffer from now on. Call it after the transfer of
+    the buffer has been started: the transfer keeps reading the buffer it
+    was given, while the next frame is drawn into the other one. The
+    content is copied across first, so the next frame only has to draw
+    what changes, and the dirty marks carry on as they are.
+    Does nothing without a back buffer.
+*/
+void u8g2_SwapBuffer(u8g2_t *u8g2)
+{
+  uint8_t *ptr;
+  size_t cnt;
+  
+  ptr = u8g2->back_buf_ptr;
+  if ( ptr == NULL )
+    return;
+  cnt = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  cnt *= u8g2->tile_buf_height;
+  cnt *= 8;
+  memcpy(ptr, u8g2->tile_buf_ptr, cnt);
+  u8g2->back_buf_ptr = u8g2->tile_buf_ptr;
+  u8g2->tile_buf_ptr = ptr;
+}
+#endif /* U8G2_WITH_BACK_BUFFER */
+
 /*============================================*/
 void u8g2_SetBufferCurrTileRow(u8g2_t *u8g2, uint8_t row)
 {
@@ -179,3 +317,177 @@ void u8g2_UpdateDisplay(u8g2_t *u8g2)
 {
   u8g2_send_buffer(u8g2);
 }
+
+/*============================================*/
+/* one window, or one u8x8_DrawTile() per tile row if the display has no address window */
+static void u8g2_send_window(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+{
+  uint8_t *ptr;
+  
+  ptr = u8g2_GetBufferPtr(u8g2);
+  ptr += tx*8;
+  ptr += u8g2->pixel_buf_width*ty;
+  if ( u8x8_DrawWindow(u8g2_GetU8x8(u8g2), tx, ty, tw, th, ptr, u8g2->pixel_buf_width) == 0 )
+    u8g2_UpdateDisplayArea(u8g2, tx, ty, tw, th);
+}
+
+/*
+  Description:
+    Send a sub area of the buffer to the display with a single address window:
+    the position goes out once and the tiles of all rows follow as one stream of
+    data, instead of one u8x8_DrawTile() with its own position per tile row.
+    Displays without an address window get one u8x8_DrawTile() per row.
+    The dirty marks of the area are removed.
+
+  Limitations:
+    same as u8g2_UpdateDisplayArea()
+*/
+void u8g2_SendWindow(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+{
+  /* check, whether we are in full buffer mode */
+  if ( u8g2->tile_buf_height != u8g2_GetU8x8(u8g2)->display_info->tile_height )
+    return; /* not in full buffer mode, do nothing */
+  
+  u8g2_send_window(u8g2, tx, ty, tw, th);
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_ClearDirtyTiles(u8g2, tx, ty, tw, th);
+#endif /* U8G2_WITH_DIRTY_TILES */
+}
+
+/* 
+  Send the complete buffer as one window: one address command prefix and 
+  all tiles of the display in a single stream of data.
+  Only available in full buffer mode.
+*/
+void u8g2_SendFrame(u8g2_t *u8g2)
+{
+  u8g2_SendWindow(u8g2, 0, 0, 
+    u8g2_GetU8x8(u8g2)->display_info->tile_width, 
+    u8g2_GetU8x8(u8g2)->display_info->tile_height);
+}
+
+#ifdef U8G2_WITH_DIRTY_TILES
+/*============================================*/
+/*
+  Description:
+    Mark all tiles of the buffer as changed, so that the next
+    u8g2_SendDirtyTiles() transfers the complete buffer.
+    Called by u8g2_SetupBuffer(), because the content of the display RAM is unknown.
+*/
+void u8g2_MarkBufferDirty(u8g2_t *u8g2)
+{
+  uint8_t row;
+  uint8_t w;
+  uint32_t mask;
+  
+  w = u8g2_GetU8x8(u8g2)->display_info->tile_width;
+  mask = ((uint32_t)2 << (w - 1)) - 1;
+  for( row = 0; row < U8G2_DIRTY_TILE_ROWS; row++ )
+    u8g2->dirty_tiles[row] = mask;
+}
+
+/*
+  Description:
+    Mark the tiles covered by a box as changed. For drawing procedures which
+    write into the buffer without u8g2_ll_hvline_vertical_top_lsb().
+  Args:
+    x, y, w, h:	the box in display coordinates, must be inside the current
+    		buffer, w and h must not be 0
+*/
+void u8g2_MarkDirtyBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint32_t mask;
+  uint8_t row, last_row;
+  
+  y -= u8g2->pixel_curr_row;
+  row = y >> 3;
+  last_row = ((uint16_t)y + h - 1) >> 3;
+  mask = ((uint32_t)2 << (((uint16_t)x + w - 1) >> 3)) - ((uint32_t)1 << (x >> 3));
+  while( row <= last_row )
+  {
+    u8g2->dirty_tiles[row] |= mask;
+    row++;
+  }
+}
+
+/*
+  Description:
+    Remove the marks of a tile area, so that u8g2_SendDirtyTiles() leaves it
+    alone. For areas whose display RAM is written without the buffer, e.g. 
+    text rendered with u8x8_RenderString() and sent with u8x8_DrawWindow().
+  Args:
+    tx, ty, tw, th:	the area in tiles, tw and th must not be 0
+*/
+void u8g2_ClearDirtyTiles(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th)
+{
+  uint32_t mask;
+  
+  mask = ((uint32_t)2 << (tx + tw - 1)) - ((uint32_t)1 << tx);
+  while( th > 0 )
+  {
+    u8g2->dirty_tiles[ty] &= ~mask;
+    ty++;
+    th--;
+  }
+}
+
+/*
+  Description:
+    Transfer only the tiles which were changed since the last transfer.
+    Neighbouring tile rows with the same marks are taken together, and each
+    run of dirty tiles across them is sent as one window (u8g2_SendWindow()),
+    then all marks are removed. A completely dirty buffer goes out as a
+    single window, like u8g2_SendFrame().
+
+  Limitations:
+    - Only available in full buffer mode (will not do anything in page mode)
+    - Only tracked by u8g2_ll_hvline_vertical_top_lsb (SSD13xx, UC1701)
+    - Will not send the e-paper refresh message
+*/
+void u8g2_SendDirtyTiles(u8g2_t *u8g2)
+{
+  uint8_t row;
+  uint8_t th;
+  uint8_t tx;
+  uint8_t tw;
+  uint32_t dirty;
+  
+  /* check, whether we are in full buffer mode */
+  if ( u8g2->tile_buf_height != u8g2_GetU8x8(u8g2)->display_info->tile_height )
+    return; /* not in full buffer mode, do nothing */
+  
+  row = 0;
+  while( row < u8g2->tile_buf_height )
+  {
+    dirty = u8g2->dirty_tiles[row];
+    u8g2->dirty_tiles[row] = 0;
+    /* the rows below with the same marks share the windows */
+    th = 1;
+    while( row + th < u8g2->tile_buf_height && u8g2->dirty_tiles[row + th] == dirty )
+    {
+      u8g2->dirty_tiles[row + th] = 0;
+      th++;
+    }
+    tx = 0;
+    while( dirty != 0 )
+    {
+      /* skip clean tiles */
+      while( (dirty & 1) == 0 )
+      {
+	dirty >>= 1;
+	tx++;
+      }
+      /* measure the run of dirty tiles */
+      tw = 0;
+      while( (dirty & 1) != 0 )
+      {
+	dirty >>= 1;
+	tw++;
+      }
+      u8g2_send_window(u8g2, tx, row, tw, th);
+      tx += tw;
+    }
+    row += th;
+  }
+}
+#endif /* U8G2_WITH_DIRTY_TILES */
@@ -121,13 +121,66 @@ void u8g2_DrawCircle(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t r
   u8g2_draw_circle(u8g2, x0, y0, rad, option);
 }
 
+/*==============================================*/
+/* Spans */
+
+#ifdef U8G2_WITH_SPAN_FILL
+/* a disc or filled ellipse for u8g2_FillSpans() */
+typedef struct
+{
+  u8g2_uint_t x0, y0;
+  u8g2_uint_t rx, ry;		/* a disc has rx == ry == rad */
+  uint8_t option;
+} u8g2_filled_round_t;
+
+/*
+  The vertical lines of a section, w columns left and right of the center
+  column and h rows above and below the center row. The shapes are convex,
+  so the columns between them are filled anyway: each line becomes the run
+  from the center column to it, in every row it covers.
+*/
+static void u8g2_add_section_spans(u8g2_span_t *span, u8g2_uint_t w, u8g2_uint_t h, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
+{
+  int16_t x_left = x0;
+  int16_t x_right = x0;
+  int16_t y_top = y0;
+  int16_t y_bottom = y0;
+  
+  x_right++;
+  y_bottom++;
+  if ( option & (U8G2_DRAW_UPPER_RIGHT|U8G2_DRAW_UPPER_LEFT) )
+  {
+    u8g2_AddSpans(span,
+      option & U8G2_DRAW_UPPER_LEFT ? x_left - w : x_left,
+      option & U8G2_DRAW_UPPER_RIGHT ? x_right + w : x_right,
+      y_top - h, y_bottom);
+  }
+  if ( option & (U8G2_DRAW_LOWER_RIGHT|U8G2_DRAW_LOWER_LEFT) )
+  {
+    u8g2_AddSpans(span,
+      option & U8G2_DRAW_LOWER_LEFT ? x_left - w : x_left,
+      option & U8G2_DRAW_LOWER_RIGHT ? x_right + w : x_right,
+      y_top, y_bottom + h);
+  }
+}
+#endif /* U8G2_WITH_SPAN_FILL */
+
 /*==============================================*/
 /* Disk */
 
-static void u8g2_draw_disc_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
+static void u8g2_draw_disc_section(u8g2_t *u8g2, u8g2_span_t *span, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
 
-static void u8g2_draw_disc_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
+static void u8g2_draw_disc_section(u8g2_t *u8g2, u8g2_span_t *span, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
 {
+#ifdef U8G2_WITH_SPAN_FILL
+    if ( span != NULL )
+    {
+      u8g2_add_section_spans(span, x, y, x0, y0, option);
+      u8g2_add_section_spans(span, y, x, x0, y0, option);
+      return;
+    }
+#endif /* U8G2_WITH_SPAN_FILL */
+    
     /* upper right */
     if ( option & U8G2_DRAW_UPPER_RIGHT )
     {
@@ -157,7 +210,7 @@ static void u8g2_draw_disc_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u
     }
 }
 
-static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
+static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_span_t *span, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
 {
   u8g2_int_t f;
   u8g2_int_t ddF_x;
@@ -174,7 +227,7 @@ static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_ui
   x = 0;
   y = rad;
 
-  u8g2_draw_disc_section(u8g2, x, y, x0, y0, option);
+  u8g2_draw_disc_section(u8g2, span, x, y, x0, y0, option);
   
   while ( x < y )
   {
@@ -188,10 +241,18 @@ static void u8g2_draw_disc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_ui
     ddF_x += 2;
     f += ddF_x;
 
-    u8g2_draw_disc_section(u8g2, x, y, x0, y0, option);    
+    u8g2_draw_disc_section(u8g2, span, x, y, x0, y0, option);    
   }
 }
 
+#ifdef U8G2_WITH_SPAN_FILL
+static void u8g2_disc_spans(u8g2_t *u8g2, u8g2_span_t *span, void *shape)
+{
+  u8g2_filled_round_t *disc = (u8g2_filled_round_t *)shape;
+  u8g2_draw_disc(u8g2, span, disc->x0, disc->y0, disc->rx, disc->option);
+}
+#endif /* U8G2_WITH_SPAN_FILL */
+
 void u8g2_DrawDisc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad, uint8_t option)
 {
   /* check for bounding box */
@@ -202,8 +263,16 @@ void u8g2_DrawDisc(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rad
   }
 #endif /* U8G2_WITH_INTERSECTION */
   
+#ifdef U8G2_WITH_SPAN_FILL
+  {
+    u8g2_filled_round_t disc = { x0, y0, rad, rad, option };
+    if ( u8g2_FillSpans(u8g2, (int16_t)y0 - rad, (int16_t)y0 + rad + 1, u8g2_disc_spans, &disc) != 0 )
+      return;
+  }
+#endif /* U8G2_WITH_SPAN_FILL */
+  
   /* draw disc */
-  u8g2_draw_disc(u8g2, x0, y0, rad, option);
+  u8g2_draw_disc(u8g2, NULL, x0, y0, rad, option);
 }
 
 /*==============================================*/
@@ -346,9 +415,17 @@ void u8g2_DrawEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t
 /*==============================================*/
 /* Filled Ellipse */
 
-static void u8g2_draw_filled_ellipse_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
-static void u8g2_draw_filled_ellipse_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
+static void u8g2_draw_filled_ellipse_section(u8g2_t *u8g2, u8g2_span_t *span, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option) U8G2_NOINLINE;
+static void u8g2_draw_filled_ellipse_section(u8g2_t *u8g2, u8g2_span_t *span, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t x0, u8g2_uint_t y0, uint8_t option)
 {
+#ifdef U8G2_WITH_SPAN_FILL
+    if ( span != NULL )
+    {
+      u8g2_add_section_spans(span, x, y, x0, y0, option);
+      return;
+    }
+#endif /* U8G2_WITH_SPAN_FILL */
+    
     /* upper right */
     if ( option & U8G2_DRAW_UPPER_RIGHT )
     {
@@ -374,7 +451,7 @@ static void u8g2_draw_filled_ellipse_section(u8g2_t *u8g2, u8g2_uint_t x, u8g2_u
     }
 }
 
-static void u8g2_draw_filled_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
+static void u8g2_draw_filled_ellipse(u8g2_t *u8g2, u8g2_span_t *span, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
 {
   u8g2_uint_t x, y;
   u8g2_long_t xchg, ychg;
@@ -411,7 +488,7 @@ static void u8g2_draw_filled_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y
   
   while( stopx >= stopy )
   {
-    u8g2_draw_filled_ellipse_section(u8g2, x, y, x0, y0, option);
+    u8g2_draw_filled_ellipse_section(u8g2, span, x, y, x0, y0, option);
     y++;
     stopy += rxrx2;
     err += ychg;
@@ -447,7 +524,7 @@ static void u8g2_draw_filled_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y
 
   while( stopx <= stopy )
   {
-    u8g2_draw_filled_ellipse_section(u8g2, x, y, x0, y0, option);
+    u8g2_draw_filled_ellipse_section(u8g2, span, x, y, x0, y0, option);
     x++;
     stopx += ryry2;
     err += xchg;
@@ -463,6 +540,14 @@ static void u8g2_draw_filled_ellipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y
   
 }
 
+#ifdef U8G2_WITH_SPAN_FILL
+static void u8g2_filled_ellipse_spans(u8g2_t *u8g2, u8g2_span_t *span, void *shape)
+{
+  u8g2_filled_round_t *ellipse = (u8g2_filled_round_t *)shape;
+  u8g2_draw_filled_ellipse(u8g2, span, ellipse->x0, ellipse->y0, ellipse->rx, ellipse->ry, ellipse->option);
+}
+#endif /* U8G2_WITH_SPAN_FILL */
+
 void u8g2_DrawFilledEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_uint_t rx, u8g2_uint_t ry, uint8_t option)
 {
   /* check for bounding box */
@@ -473,7 +558,15 @@ void u8g2_DrawFilledEllipse(u8g2_t *u8g2, u8g2_uint_t x0, u8g2_uint_t y0, u8g2_u
   }
 #endif /* U8G2_WITH_INTERSECTION */
   
-  u8g2_draw_filled_ellipse(u8g2, x0, y0, rx, ry, option);
+#ifdef U8G2_WITH_SPAN_FILL
+  {
+    u8g2_filled_round_t ellipse = { x0, y0, rx, ry, option };
+    if ( u8g2_FillSpans(u8g2, (int16_t)y0 - ry, (int16_t)y0 + ry + 1, u8g2_filled_ellipse_spans, &ellipse) != 0 )
+      return;
+  }
+#endif /* U8G2_WITH_SPAN_FILL */
+  
+  u8g2_draw_filled_ellipse(u8g2, NULL, x0, y0, rx, ry, option);
 }
 
 
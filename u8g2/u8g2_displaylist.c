@@ -0,0 +1,413 @@
+/*
+
+  u8g2_displaylist.c
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Copyright (c) 2016, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+  Retained mode drawing for page buffers.
+
+  A screen is recorded once into a display list: a byte buffer of
+  commands, each with the rows it covers and the draw state it needs.
+  u8g2_DrawDisplayList() replays the list into the current page and skips
+  every command outside of the page rows, so the page loop contract
+  (draw everything for every page) is kept without drawing the screen
+  again. The list remembers which pages its commands have touched since the
+  last transfer, and u8g2_SendDisplayList() renders and sends only those.
+
+  Strings are copied into the list, images, bitmaps, fonts, digit
+  atlases and run length coded frames are referenced and have to stay
+  valid as long as the list is used.
+
+*/
+
+#include "../u8g2Headers/u8g2.h"
+#include <string.h>
+
+#define U8G2_DL_IMAGE 1
+#define U8G2_DL_BOX 2
+#define U8G2_DL_PAGE_BITMAP 3
+#define U8G2_DL_XBM 4
+#define U8G2_DL_STR 5
+#define U8G2_DL_DIGITS 6
+#define U8G2_DL_RLE 7
+
+/* the start of each command, the arguments follow */
+typedef struct
+{
+  uint8_t op;
+  uint8_t size;			/* of the complete command in bytes */
+  uint8_t color;		/* draw color */
+  uint8_t is_transparent;	/* bitmap or font mode */
+  u8g2_uint_t y;		/* first row */
+  u8g2_uint_t h;		/* rows */
+} u8g2_dl_head_t;
+
+typedef struct
+{
+  u8g2_uint_t x, y, w, h;
+  const uint8_t *bitmap;
+} u8g2_dl_bitmap_t;
+
+typedef struct
+{
+  u8g2_uint_t x, y;
+  const uint8_t *font;
+  uint8_t dir;
+} u8g2_dl_str_t;
+
+typedef struct
+{
+  u8g2_uint_t x, y;
+  const u8g2_digit_atlas_t *atlas;
+  uint16_t v;
+  uint8_t cnt;
+} u8g2_dl_digits_t;
+
+/*============================================*/
+
+/*
+  Description:
+    Count the pages of rows y to y+h-1 as changed, e.g. because something
+    else has written the display RAM there.
+*/
+void u8g2_MarkDisplayListRows(u8g2_dl_t *dl, u8g2_uint_t y, u8g2_uint_t h)
+{
+  uint8_t page, last_page;
+
+  if ( h == 0 )
+    return;
+  page = y >> 3;
+  last_page = ((uint16_t)y + h - 1) >> 3;
+  while( page <= last_page && page < 32 )
+  {
+    dl->dirty_pages |= (uint32_t)1 << page;
+    page++;
+  }
+}
+
+/* append a command, "args" is copied behind the head, "tail" behind the args */
+static uint8_t u8g2_dl_add(u8g2_t *u8g2, u8g2_dl_t *dl, uint8_t op, u8g2_uint_t y, u8g2_uint_t h, uint8_t is_transparent, const void *args, uint8_t args_size, const void *tail, uint16_t tail_size)
+{
+  u8g2_dl_head_t head;
+  uint16_t size = sizeof(head) + args_size + tail_size;
+
+  if ( size > 255 || dl->len + size > dl->size )
+  {
+    dl->is_overflow = 1;
+    return 0;
+  }
+  head.op = op;
+  head.size = size;
+  head.color = u8g2->draw_color;
+  head.is_transparent = is_transparent;
+  head.y = y;
+  head.h = h;
+  /* memcpy, because a command does not start word aligned */
+  memcpy(dl->buf + dl->len, &head, sizeof(head));
+  memcpy(dl->buf + dl->len + sizeof(head), args, args_size);
+  memcpy(dl->buf + dl->len + sizeof(head) + args_size, tail, tail_size);
+  dl->len += size;
+  u8g2_MarkDisplayListRows(dl, y, h);
+  return 1;
+}
+
+/*
+  Description:
+    Use "buf" with "size" bytes for the commands of a display list. The list
+    is empty and all pages count as changed.
+*/
+void u8g2_InitDisplayList(u8g2_dl_t *dl, uint8_t *buf, uint16_t size)
+{
+  dl->buf = buf;
+  dl->size = size;
+  u8g2_ClearDisplayList(dl);
+}
+
+/*
+  Description:
+    Remove all commands, for a new screen. All pages count as changed.
+*/
+void u8g2_ClearDisplayList(u8g2_dl_t *dl)
+{
+  dl->len = 0;
+  dl->is_overflow = 0;
+  dl->dirty_pages = 0xffffffff;
+}
+
+/*
+  Description:
+    Remove the commands recorded after u8g2_GetDisplayListMark() returned
+    "mark". Their rows count as changed, so the next transfer draws them
+    without those commands.
+*/
+void u8g2_RewindDisplayList(u8g2_dl_t *dl, uint16_t mark)
+{
+  u8g2_dl_head_t head;
+  uint16_t pos = mark;
+
+  while( pos < dl->len )
+  {
+    memcpy(&head, dl->buf + pos, sizeof(head));
+    u8g2_MarkDisplayListRows(dl, head.y, head.h);
+    pos += head.size;
+  }
+  dl->len = mark;
+  dl->is_overflow = 0;
+}
+
+/*
+  Description:
+    Record u8g2_ComposeBuffer() with a full screen image.
+*/
+uint8_t u8g2_RecordImage(u8g2_t *u8g2, u8g2_dl_t *dl, const uint8_t *image, uint8_t rop)
+{
+  return u8g2_dl_add(u8g2, dl, U8G2_DL_IMAGE, 0, u8g2->height, rop, &image, sizeof(image), NULL, 0);
+}
+
+/*
+  Description:
+    Record u8g2_DrawBox() in the current draw color.
+*/
+uint8_t u8g2_RecordBox(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  u8g2_dl_bitmap_t args;
+
+  args.x = x;
+  args.y = y;
+  args.w = w;
+  args.h = h;
+  args.bitmap = NULL;
+  return u8g2_dl_add(u8g2, dl, U8G2_DL_BOX, y, h, 0, &args, sizeof(args), NULL, 0);
+}
+
+static uint8_t u8g2_dl_bitmap(u8g2_t *u8g2, u8g2_dl_t *dl, uint8_t op, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  u8g2_dl_bitmap_t args;
+
+  args.x = x;
+  args.y = y;
+  args.w = w;
+  args.h = h;
+  args.bitmap = bitmap;
+  return u8g2_dl_add(u8g2, dl, op, y, h, u8g2->bitmap_transparency, &args, sizeof(args), NULL, 0);
+}
+
+/*
+  Description:
+    Record u8g2_DrawPageBitmap() with the current draw color and bitmap mode.
+*/
+uint8_t u8g2_RecordPageBitmap(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  return u8g2_dl_bitmap(u8g2, dl, U8G2_DL_PAGE_BITMAP, x, y, w, h, bitmap);
+}
+
+/*
+  Description:
+    Record u8g2_DrawXBM() with the current draw color and bitmap mode.
+*/
+uint8_t u8g2_RecordXBM(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+{
+  return u8g2_dl_bitmap(u8g2, dl, U8G2_DL_XBM, x, y, w, h, bitmap);
+}
+
+/*
+  Description:
+    Record u8g2_DrawStr() with the current font, font direction, font mode
+    and draw color. The string is copied into the list. Strings in font
+    direction 0 are culled by the height of the font, all others are drawn
+    for every page.
+*/
+uint8_t u8g2_RecordStr(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, const char *s)
+{
+  u8g2_dl_str_t args;
+  u8g2_uint_t top = 0;
+  u8g2_uint_t h = u8g2->height;
+
+  args.x = x;
+  args.y = y;
+  args.font = u8g2->font;
+  args.dir = 0;
+#ifdef U8G2_WITH_FONT_ROTATION
+  args.dir = u8g2->font_decode.dir;
+#endif
+  if ( args.dir == 0 )
+  {
+    /* ascent = max_char_height + y_offset */
+    top = y - (u8g2->font_info.max_char_height + u8g2->font_info.y_offset);
+    h = u8g2->font_info.max_char_height;
+  }
+  return u8g2_dl_add(u8g2, dl, U8G2_DL_STR, top, h, u8g2->font_decode.is_transparent, &args, sizeof(args), s, strlen(s)+1);
+}
+
+/*
+  Description:
+    Record u8g2_DrawDigits() with the current draw color and bitmap mode.
+*/
+uint8_t u8g2_RecordDigits(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, const u8g2_digit_atlas_t *atlas, uint16_t v, uint8_t cnt)
+{
+  u8g2_dl_digits_t args;
+
+  args.x = x;
+  args.y = y;
+  args.atlas = atlas;
+  args.v = v;
+  args.cnt = cnt;
+  return u8g2_dl_add(u8g2, dl, U8G2_DL_DIGITS, y - atlas->ascent, atlas->h, u8g2->bitmap_transparency, &args, sizeof(args), NULL, 0);
+}
+
+/*
+  Description:
+    Record u8g2_DrawRleFrame(). Only the pages the frame covers count as
+    changed, so recording the deltas of an animation one after the other
+    after its first frame redraws only what each of them changes.
+*/
+uint8_t u8g2_RecordRleFrame(u8g2_t *u8g2, u8g2_dl_t *dl, const uint8_t *rle)
+{
+  return u8g2_dl_add(u8g2, dl, U8G2_DL_RLE, rle[0] * 8, rle[1] * 8, 0, &rle, sizeof(rle), NULL, 0);
+}
+
+/*============================================*/
+
+/*
+  Description:
+    Draw the commands of the list which cover rows of the current page (all
+    of them in full buffer mode), in the order they were recorded. The draw
+    state of u8g2 is restored afterwards.
+*/
+void u8g2_DrawDisplayList(u8g2_t *u8g2, const u8g2_dl_t *dl)
+{
+  u8g2_dl_head_t head;
+  u8g2_dl_bitmap_t b;
+  u8g2_dl_str_t s;
+  u8g2_dl_digits_t d;
+  const uint8_t *cmd;
+  const uint8_t *args;
+  uint16_t pos;
+  u8g2_uint_t page_y0 = u8g2->pixel_curr_row;
+  u8g2_uint_t page_y1 = page_y0 + u8g2->pixel_buf_height;
+  uint8_t color = u8g2->draw_color;
+  uint8_t bitmap_transparency = u8g2->bitmap_transparency;
+  uint8_t font_transparency = u8g2->font_decode.is_transparent;
+  const uint8_t *font = u8g2->font;
+#ifdef U8G2_WITH_FONT_ROTATION
+  uint8_t dir = u8g2->font_decode.dir;
+#endif
+
+  for( pos = 0; pos < dl->len; pos += head.size )
+  {
+    cmd = dl->buf + pos;
+    memcpy(&head, cmd, sizeof(head));
+    /* cull against the rows of the page */
+    if ( head.y >= page_y1 || (uint16_t)head.y + head.h <= page_y0 )
+      continue;
+    args = cmd + sizeof(head);
+    u8g2->draw_color = head.color;
+    switch( head.op )
+    {
+      case U8G2_DL_IMAGE:
+	memcpy(&b.bitmap, args, sizeof(b.bitmap));
+	u8g2_ComposeBuffer(u8g2, b.bitmap, head.is_transparent);
+	break;
+      case U8G2_DL_BOX:
+	memcpy(&b, args, sizeof(b));
+	u8g2_DrawBox(u8g2, b.x, b.y, b.w, b.h);
+	break;
+      case U8G2_DL_PAGE_BITMAP:
+	memcpy(&b, args, sizeof(b));
+	u8g2->bitmap_transparency = head.is_transparent;
+	u8g2_DrawPageBitmap(u8g2, b.x, b.y, b.w, b.h, b.bitmap);
+	break;
+      case U8G2_DL_XBM:
+	memcpy(&b, args, sizeof(b));
+	u8g2->bitmap_transparency = head.is_transparent;
+	u8g2_DrawXBM(u8g2, b.x, b.y, b.w, b.h, b.bitmap);
+	break;
+      case U8G2_DL_STR:
+	memcpy(&s, args, sizeof(s));
+	u8g2_SetFont(u8g2, s.font);
+	u8g2_SetFontMode(u8g2, head.is_transparent);
+#ifdef U8G2_WITH_FONT_ROTATION
+	u8g2_SetFontDirection(u8g2, s.dir);
+#endif
+	u8g2_DrawStr(u8g2, s.x, s.y, (const char *)(args + sizeof(s)));
+	break;
+      case U8G2_DL_DIGITS:
+	memcpy(&d, args, sizeof(d));
+	u8g2->bitmap_transparency = head.is_transparent;
+	u8g2_DrawDigits(u8g2, d.x, d.y, d.atlas, d.v, d.cnt);
+	break;
+      case U8G2_DL_RLE:
+	memcpy(&b.bitmap, args, sizeof(b.bitmap));
+	u8g2_DrawRleFrame(u8g2, b.bitmap);
+	break;
+    }
+  }
+  u8g2->draw_color = color;
+  u8g2->bitmap_transparency = bitmap_transparency;
+  if ( font != NULL )
+    u8g2_SetFont(u8g2, font);
+  u8g2_SetFontMode(u8g2, font_transparency);
+#ifdef U8G2_WITH_FONT_ROTATION
+  u8g2_SetFontDirection(u8g2, dir);
+#endif
+}
+
+/*
+  Description:
+    Page loop over the pages the list has changed since the last call:
+    each one is cleared, drawn from the list and sent. Pages the list has
+    not touched are skipped, the display RAM still holds them.
+    In full buffer mode the whole buffer is drawn and sent once.
+  Returns:
+    The pages which have been sent, bit n is tile row n of the display.
+*/
+uint32_t u8g2_SendDisplayList(u8g2_t *u8g2, u8g2_dl_t *dl)
+{
+  uint32_t sent = 0;
+  uint32_t rows_mask;
+  uint8_t row;
+  uint8_t tile_height = u8g2_GetU8x8(u8g2)->display_info->tile_height;
+
+  for( row = 0; row < tile_height; row += u8g2->tile_buf_height )
+  {
+    rows_mask = (((uint32_t)1 << u8g2->tile_buf_height) - 1) << row;
+    if ( (dl->dirty_pages & rows_mask) == 0 )
+      continue;
+    u8g2_SetBufferCurrTileRow(u8g2, row);
+    u8g2_ClearBuffer(u8g2);
+    u8g2_DrawDisplayList(u8g2, dl);
+    u8g2_UpdateDisplay(u8g2);
+    sent |= rows_mask;
+  }
+  dl->dirty_pages = 0;
+  u8g2_SetBufferCurrTileRow(u8g2, 0);
+  return sent;
+}
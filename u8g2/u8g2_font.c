@@ -450,6 +450,161 @@ void u8g2_font_decode_len(u8g2_t *u8g2, uint8_t len, uint8_t is_foreground)
   
 }
 
+#if defined(U8G2_WITH_DIRECT_GLYPH_DECODE) || defined(U8G2_WITH_GLYPH_CACHE)
+/*
+  Description:
+    Check whether glyphs may be written directly into the buffer: no font
+    rotation and a buffer u8g2_PageBlit() can write to.
+*/
+static uint8_t u8g2_font_is_direct(u8g2_t *u8g2)
+{
+#ifdef U8G2_WITH_FONT_ROTATION
+  if ( u8g2->font_decode.dir != 0 )
+    return 0;
+#endif
+  return u8g2_IsPageBlitBuffer(u8g2);
+}
+#endif
+
+#ifdef U8G2_WITH_DIRECT_GLYPH_DECODE
+/* bit reader for u8g2_font_decode_direct() */
+struct _u8g2_font_bits_t
+{
+  const uint8_t *ptr;		/* next byte to load */
+  const uint8_t *end;		/* end of the glyph data */
+  uint32_t bits;		/* unread bits, next bit is bit 0 */
+  uint8_t cnt;			/* number of valid bits in "bits" */
+};
+typedef struct _u8g2_font_bits_t u8g2_font_bits_t;
+
+static uint8_t u8g2_font_bits_get(u8g2_font_bits_t *r, uint8_t cnt)
+{
+  uint8_t val;
+  
+  if ( r->cnt < cnt )
+  {
+    /* refill as many whole bytes as fit */
+    while( r->cnt <= 24 && r->ptr < r->end )
+    {
+      r->bits |= (uint32_t)u8x8_pgm_read( r->ptr ) << r->cnt;
+      r->ptr++;
+      r->cnt += 8;
+    }
+  }
+  val = r->bits & ((1U<<cnt)-1);
+  r->bits >>= cnt;
+  r->cnt -= cnt;
+  return val;
+}
+
+/* one run of pixels within a row, ptr points to the first column byte */
+static void u8g2_font_direct_run(uint8_t *ptr, uint8_t mask, uint8_t len, uint8_t color)
+{
+  if ( color == 0 )
+  {
+    mask = ~mask;
+    do { *ptr++ &= mask; } while( --len != 0 );
+  }
+  else if ( color == 1 )
+  {
+    do { *ptr++ |= mask; } while( --len != 0 );
+  }
+  else
+  {
+    do { *ptr++ ^= mask; } while( --len != 0 );
+  }
+}
+
+/*
+  Description:
+    Decode the pixel runs of a glyph straight into the buffer. Called by
+    u8g2_font_decode_glyph() after the glyph header has been read, if the
+    glyph is completely inside the buffer and not rotated.
+  Args:
+    glyph_data: 				Pointer to the compressed glyph data, as for u8g2_font_decode_glyph()
+    u8g2->font_decode.target_x/y	Upper left corner of the glyph
+*/
+static void u8g2_font_decode_direct(u8g2_t *u8g2, const uint8_t *glyph_data)
+{
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  u8g2_font_bits_t r;
+  uint8_t *row_ptr;
+  uint8_t mask;
+  uint8_t w, h;
+  uint8_t lx, ly;
+  uint8_t len, current;
+  uint8_t is_foreground;
+  uint8_t color;
+  u8g2_uint_t y0;
+  
+  /* continue where the header decoding stopped */
+  r.ptr = decode->decode_ptr;
+  /* the glyph size byte comes right before glyph_data, the record starts */
+  /* one (unicode: two) bytes before it, so the reader may load one byte of */
+  /* the next record for unicode glyphs, but never beyond the font */
+  r.end = glyph_data - 2 + u8x8_pgm_read( glyph_data - 1 );
+  r.bits = u8x8_pgm_read( r.ptr ) >> decode->decode_bit_pos;
+  r.cnt = 8 - decode->decode_bit_pos;
+  r.ptr++;
+  
+  w = decode->glyph_width;
+  h = decode->glyph_height;
+  y0 = decode->target_y;
+  y0 -= u8g2->pixel_curr_row;
+  row_ptr = u8g2->tile_buf_ptr;
+  row_ptr += (uint16_t)(y0 >> 3) * u8g2->pixel_buf_width;
+  row_ptr += decode->target_x;
+  mask = 1 << (y0 & 7);
+  lx = 0;
+  ly = 0;
+  
+  for(;;)
+  {
+    uint8_t a, b;
+    a = u8g2_font_bits_get(&r, u8g2->font_info.bits_per_0);
+    b = u8g2_font_bits_get(&r, u8g2->font_info.bits_per_1);
+    do
+    {
+      /* background run, then foreground run */
+      for( is_foreground = 0; is_foreground < 2; is_foreground++ )
+      {
+	len = is_foreground ? b : a;
+	color = is_foreground ? decode->fg_color : decode->bg_color;
+	while( len != 0 )
+	{
+	  current = w - lx;
+	  if ( len < current )
+	    current = len;
+	  if ( ly < h && (is_foreground || decode->is_transparent == 0) )
+	    u8g2_font_direct_run(row_ptr + lx, mask, current, color);
+	  len -= current;
+	  lx += current;
+	  if ( lx >= w )
+	  {
+	    /* next row of the glyph, next bit of the column bytes */
+	    lx = 0;
+	    ly++;
+	    mask <<= 1;
+	    if ( mask == 0 )
+	    {
+	      mask = 1;
+	      row_ptr += u8g2->pixel_buf_width;
+	    }
+	  }
+	}
+      }
+    } while( u8g2_font_bits_get(&r, 1) != 0 );
+
+    if ( ly >= h )
+      break;
+  }
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_MarkDirtyBox(u8g2, decode->target_x, decode->target_y, w, h);
+#endif /* U8G2_WITH_DIRTY_TILES */
+}
+#endif /* U8G2_WITH_DIRECT_GLYPH_DECODE */
+
 static void u8g2_font_setup_decode(u8g2_t *u8g2, const uint8_t *glyph_data)
 {
   u8g2_font_decode_t *decode = &(u8g2->font_decode);
@@ -556,6 +711,14 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
     }
 #endif /* U8G2_WITH_INTERSECTION */
    
+#ifdef U8G2_WITH_DIRECT_GLYPH_DECODE
+    if ( u8g2_font_is_direct(u8g2) && u8g2_IsPageBlitBox(u8g2, decode->target_x, decode->target_y, decode->glyph_width, h) )
+    {
+      u8g2_font_decode_direct(u8g2, glyph_data);
+      return d;
+    }
+#endif /* U8G2_WITH_DIRECT_GLYPH_DECODE */
+   
     /* reset local x/y position */
     decode->x = 0;
     decode->y = 0;
@@ -592,6 +755,40 @@ int8_t u8g2_font_decode_glyph(u8g2_t *u8g2, const uint8_t *glyph_data)
 const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
 {
   const uint8_t *font = u8g2->font;
+  
+#ifdef U8G2_WITH_FONT_INDEX
+  if ( encoding <= 255 )
+  {
+    if ( u8g2->font_index_flags & U8G2_FONT_INDEX_8BIT )
+    {
+      uint16_t i = encoding;
+      i -= u8g2->font_index_first;	/* wraps around for encodings below first */
+      if ( i >= u8g2->font_index_cnt || u8g2->font_index[i] == 0 )
+	return NULL;
+      return font + u8g2->font_index[i] + 2;	/* skip encoding and glyph size */
+    }
+  }
+  else if ( u8g2->font_index_flags & U8G2_FONT_INDEX_UNICODE )
+  {
+    const uint16_t *pairs = u8g2->font_index + u8g2->font_index_cnt;
+    uint16_t lo = 0;
+    uint16_t hi = u8g2->font_index_unicode_cnt;
+    uint16_t mid;
+    
+    while( lo < hi )
+    {
+      mid = (lo + hi) >> 1;
+      if ( pairs[2*mid] == encoding )
+	return font + pairs[2*mid+1] + 3;	/* skip encoding and glyph size */
+      if ( pairs[2*mid] < encoding )
+	lo = mid + 1;
+      else
+	hi = mid;
+    }
+    return NULL;
+  }
+#endif /* U8G2_WITH_FONT_INDEX */
+  
   font += U8G2_FONT_DATA_STRUCT_SIZE;
 
   
@@ -676,9 +873,220 @@ const uint8_t *u8g2_font_get_glyph_data(u8g2_t *u8g2, uint16_t encoding)
   return NULL;
 }
 
+#ifdef U8G2_WITH_GLYPH_CACHE
+
+#if U8G2_GLYPH_CACHE_GLYPHS > 254
+#error "U8G2_GLYPH_CACHE_GLYPHS must be 254 or less"
+#endif
+
+static void u8g2_glyph_cache_reset(u8g2_t *u8g2)
+{
+  u8g2_glyph_cache_t *cache = u8g2->glyph_cache;
+  uint8_t i;
+  
+  if ( cache == NULL )
+    return;
+  for( i = 0; i < 128; i++ )
+    cache->slot[i] = 0;
+  cache->glyph_cnt = 0;
+  cache->bitmap_used = 0;
+}
+
+/*
+  Description:
+    Same as u8g2_font_decode_len(), but the foreground pixels are set in the
+    column bitmaps of a cache entry instead of being drawn.
+*/
+static void u8g2_glyph_cache_decode_len(u8g2_font_decode_t *decode, uint8_t *bitmap, uint8_t pages, uint8_t len, uint8_t is_foreground)
+{
+  uint8_t cnt;
+  uint8_t rem;
+  uint8_t current;
+  uint8_t lx,ly;
+  uint8_t *ptr;
+  uint8_t mask;
+  
+  cnt = len;
+  lx = decode->x;
+  ly = decode->y;
+  
+  for(;;)
+  {
+    rem = decode->glyph_width;
+    rem -= lx;
+    
+    current = rem;
+    if ( cnt < rem )
+      current = cnt;
+    
+    if ( is_foreground && ly < (uint8_t)decode->glyph_height )
+    {
+      ptr = bitmap + lx*pages + (ly >> 3);
+      mask = 1 << (ly & 7);
+      while( current > 0 )
+      {
+	*ptr |= mask;
+	ptr += pages;
+	current--;
+      }
+    }
+    
+    if ( cnt < rem )
+      break;
+    cnt -= rem;
+    lx = 0;
+    ly++;
+  }
+  lx += cnt;
+  
+  decode->x = lx;
+  decode->y = ly;
+}
+
+/*
+  Description:
+    Decode a glyph of the current font into the glyph cache.
+  Return:
+    Cache slot value for the glyph: entry index+1, or 255 if the glyph
+    does not exist or does not fit.
+*/
+static uint8_t u8g2_glyph_cache_fill(u8g2_t *u8g2, uint16_t encoding)
+{
+  u8g2_glyph_cache_t *cache = u8g2->glyph_cache;
+  u8g2_font_decode_t *decode = &(u8g2->font_decode);
+  u8g2_glyph_cache_entry_t *entry;
+  const uint8_t *glyph_data;
+  uint8_t *bitmap;
+  uint16_t size;
+  uint16_t i;
+  uint8_t pages;
+  uint8_t a, b;
+  
+  if ( cache->glyph_cnt >= U8G2_GLYPH_CACHE_GLYPHS )
+    return 255;
+  glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
+  if ( glyph_data == NULL )
+    return 255;
+  
+  u8g2_font_setup_decode(u8g2, glyph_data);
+  entry = cache->entry + cache->glyph_cnt;
+  entry->width = decode->glyph_width;
+  entry->height = decode->glyph_height;
+  entry->x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
+  entry->y = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
+  entry->delta_x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+  
+  pages = (entry->height + 7) >> 3;
+  size = entry->width;
+  size *= pages;
+  if ( size > U8G2_GLYPH_CACHE_SIZE - cache->bitmap_used )
+    return 255;
+  entry->offset = cache->bitmap_used;
+  bitmap = cache->bitmap + entry->offset;
+  for( i = 0; i < size; i++ )
+    bitmap[i] = 0;
+  
+  if ( entry->width > 0 )
+  {
+    decode->x = 0;
+    decode->y = 0;
+    for(;;)
+    {
+      a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
+      b = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_1);
+      do
+      {
+	u8g2_glyph_cache_decode_len(decode, bitmap, pages, a, 0);
+	u8g2_glyph_cache_decode_len(decode, bitmap, pages, b, 1);
+      } while( u8g2_font_decode_get_unsigned_bits(decode, 1) != 0 );
+
+      if ( decode->y >= entry->height )
+	break;
+    }
+  }
+  
+  cache->bitmap_used += size;
+  cache->glyph_cnt++;
+  return cache->glyph_cnt;
+}
+
+/*
+  Description:
+    Draw a glyph from the glyph cache. The column bitmaps are shifted to the
+    target row and combined with the buffer one byte (8 rows) at a time, with
+    the same result as u8g2_font_decode_glyph() for draw colors 0, 1 and 2 in
+    solid and transparent mode.
+  Args:
+    x, y: 	same as u8g2_font_draw_glyph()
+    dx:		receives the advance of the glyph
+  Return:
+    0 if the glyph must be drawn by the decoder instead, also without cache
+*/
+static uint8_t u8g2_glyph_cache_draw(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding, u8g2_uint_t *dx)
+{
+  u8g2_glyph_cache_t *cache = u8g2->glyph_cache;
+  u8g2_glyph_cache_entry_t *entry;
+  u8g2_uint_t x0, y0;
+  uint8_t slot;
+  
+  if ( cache == NULL || encoding >= 128 || u8g2_font_is_direct(u8g2) == 0 )
+    return 0;
+  
+  slot = cache->slot[encoding];
+  if ( slot == 0 )
+  {
+    slot = u8g2_glyph_cache_fill(u8g2, encoding);
+    cache->slot[encoding] = slot;
+  }
+  if ( slot == 255 )
+    return 0;
+  entry = cache->entry + slot - 1;
+  
+  if ( entry->width != 0 )
+  {
+    /* upper left corner, same calculation as u8g2_font_decode_glyph() */
+    x0 = x;
+    x0 += entry->x;
+    y0 = y;
+    y0 -= entry->height + entry->y;
+    
+    /* only glyphs which are completely visible, the decoder clips the others */
+    if ( u8g2_IsPageBlitBox(u8g2, x0, y0, entry->width, entry->height) == 0 )
+      return 0;
+    
+    /* column major: the pages of a column are next to each other */
+    u8g2_PageBlit(u8g2, x0, y0, entry->width, entry->height, 
+      cache->bitmap + entry->offset, (entry->height + 7) >> 3, 1, 
+      u8g2->draw_color, u8g2->font_decode.is_transparent);
+  }
+  
+  *dx = entry->delta_x;
+  return 1;
+}
+
+/*
+  Description:
+    Assign the glyph cache, it is emptied and then filled with the glyphs of
+    the current font as they are drawn. Must be called after the setup
+    procedure, which removes the cache. NULL removes the cache.
+  Args:
+    cache:	the cache, must stay valid as long as it is assigned
+*/
+void u8g2_SetGlyphCache(u8g2_t *u8g2, u8g2_glyph_cache_t *cache)
+{
+  u8g2->glyph_cache = cache;
+  u8g2_glyph_cache_reset(u8g2);
+}
+
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
 static u8g2_uint_t u8g2_font_draw_glyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding)
 {
   u8g2_uint_t dx = 0;
+#ifdef U8G2_WITH_GLYPH_CACHE
+  if ( u8g2_glyph_cache_draw(u8g2, x, y, encoding, &dx) != 0 )
+    return dx;
+#endif /* U8G2_WITH_GLYPH_CACHE */
   u8g2->font_decode.target_x = x;
   u8g2->font_decode.target_y = y;
   //u8g2->font_decode.is_transparent = is_transparent; this is already set
@@ -1026,6 +1434,104 @@ void u8g2_SetFontPosCenter(u8g2_t *u8g2)
 
 /*===============================================*/
 
+#ifdef U8G2_WITH_FONT_INDEX
+/*
+  Description:
+    Fill the index buffer for the current font, see u8g2_SetFontIndexBuffer().
+    Offsets are stored relative to the start of the font. Fonts with glyphs
+    beyond 64K are used without index.
+*/
+static void u8g2_build_font_index(u8g2_t *u8g2)
+{
+  const uint8_t *font = u8g2->font;
+  const uint8_t *glyph;
+  uint16_t *index = u8g2->font_index;
+  uint16_t len = u8g2->font_index_len;
+  uint16_t first = 255;
+  uint16_t last = 0;
+  uint16_t cnt = 0;
+  uint16_t e;
+  size_t pos;
+  
+  u8g2->font_index_flags = 0;
+  u8g2->font_index_cnt = 0;
+  u8g2->font_index_unicode_cnt = 0;
+  if ( index == NULL || font == NULL )
+    return;
+  
+  /* glyphs 0..255: find the encoding range, then store the offsets */
+  glyph = font + U8G2_FONT_DATA_STRUCT_SIZE;
+  while( u8x8_pgm_read( glyph + 1 ) != 0 )
+  {
+    e = u8x8_pgm_read( glyph );
+    if ( e < first )
+      first = e;
+    if ( e > last )
+      last = e;
+    glyph += u8x8_pgm_read( glyph + 1 );
+  }
+  if ( first <= last )
+    cnt = last - first + 1;
+  if ( cnt > len )
+    return;
+  for( e = 0; e < cnt; e++ )
+    index[e] = 0;
+  
+  glyph = font + U8G2_FONT_DATA_STRUCT_SIZE;
+  while( u8x8_pgm_read( glyph + 1 ) != 0 )
+  {
+    pos = glyph - font;
+    if ( pos > 0x0ffff )
+      return;
+    index[u8x8_pgm_read( glyph ) - first] = pos;
+    glyph += u8x8_pgm_read( glyph + 1 );
+  }
+  u8g2->font_index_first = first;
+  u8g2->font_index_cnt = cnt;
+  u8g2->font_index_flags = U8G2_FONT_INDEX_8BIT;
+  
+#ifdef U8G2_WITH_UNICODE
+  /* unicode glyphs follow their jump table and are sorted by encoding */
+  glyph = font + U8G2_FONT_DATA_STRUCT_SIZE + u8g2->font_info.start_pos_unicode;
+  glyph += u8g2_font_get_word(glyph, 0);
+  index += cnt;
+  len -= cnt;
+  for(;;)
+  {
+    e = u8g2_font_get_word(glyph, 0);
+    if ( e == 0 )
+      break;
+    pos = glyph - font;
+    if ( len < 2 || pos > 0x0ffff )
+      return;	/* unicode glyphs will be searched as before */
+    index[0] = e;
+    index[1] = pos;
+    index += 2;
+    len -= 2;
+    u8g2->font_index_unicode_cnt++;
+    glyph += u8x8_pgm_read( glyph + 2 );
+  }
+  u8g2->font_index_flags |= U8G2_FONT_INDEX_UNICODE;
+#endif /* U8G2_WITH_UNICODE */
+}
+
+/*
+  Description:
+    Assign a buffer for the glyph index of the current and all later fonts.
+    Must be called after the setup procedure, which removes the buffer.
+    NULL removes the index.
+  Args:
+    buf:	the buffer, must stay valid as long as it is assigned
+    len:	size of the buffer in words (not bytes)
+*/
+void u8g2_SetFontIndexBuffer(u8g2_t *u8g2, uint16_t *buf, uint16_t len)
+{
+  u8g2->font_index = buf;
+  u8g2->font_index_len = len;
+  u8g2_build_font_index(u8g2);
+}
+#endif /* U8G2_WITH_FONT_INDEX */
+
 void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
 {
   if ( u8g2->font != font )
@@ -1036,6 +1542,12 @@ void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font)
 //#endif 
     u8g2->font = font;
     u8g2_read_font_info(&(u8g2->font_info), font);
+#ifdef U8G2_WITH_FONT_INDEX
+    u8g2_build_font_index(u8g2);
+#endif /* U8G2_WITH_FONT_INDEX */
+#ifdef U8G2_WITH_GLYPH_CACHE
+    u8g2_glyph_cache_reset(u8g2);
+#endif /* U8G2_WITH_GLYPH_CACHE */
     u8g2_UpdateRefHeight(u8g2);
     /* u8g2_SetFontPosBaseline(u8g2); */ /* removed with issue 195 */
   }
@@ -36,7 +36,7 @@
 #include "../u8g2Headers/u8g2.h"
 
 
-void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2)
+static void u8g2_draw_line(u8g2_t *u8g2, u8g2_span_t *span, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2)
 {
   u8g2_uint_t tmp;
   u8g2_uint_t x,y;
@@ -77,6 +77,17 @@ void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2,
 
   for( x = x1; x <= x2; x++ )
   {
+#ifdef U8G2_WITH_SPAN_FILL
+    /* the pixels of a row are next to each other, they become one span */
+    if ( span != NULL )
+    {
+      if ( swapxy == 0 ) 
+	u8g2_AddSpan(span, x, x+1, y); 
+      else 
+	u8g2_AddSpan(span, y, y+1, x); 
+    }
+    else
+#endif /* U8G2_WITH_SPAN_FILL */
     if ( swapxy == 0 ) 
       u8g2_DrawPixel(u8g2, x, y); 
     else 
@@ -90,3 +101,30 @@ void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2,
   }
 }
 
+#ifdef U8G2_WITH_SPAN_FILL
+/* a line for u8g2_FillSpans() */
+typedef struct
+{
+  u8g2_uint_t x1, y1;
+  u8g2_uint_t x2, y2;
+} u8g2_line_t;
+
+static void u8g2_line_spans(u8g2_t *u8g2, u8g2_span_t *span, void *shape)
+{
+  u8g2_line_t *line = (u8g2_line_t *)shape;
+  u8g2_draw_line(u8g2, span, line->x1, line->y1, line->x2, line->y2);
+}
+#endif /* U8G2_WITH_SPAN_FILL */
+
+void u8g2_DrawLine(u8g2_t *u8g2, u8g2_uint_t x1, u8g2_uint_t y1, u8g2_uint_t x2, u8g2_uint_t y2)
+{
+#ifdef U8G2_WITH_SPAN_FILL
+  {
+    u8g2_line_t line = { x1, y1, x2, y2 };
+    if ( u8g2_FillSpans(u8g2, y1 < y2 ? y1 : y2, (y1 < y2 ? y2 : y1) + 1, u8g2_line_spans, &line) != 0 )
+      return;
+  }
+#endif /* U8G2_WITH_SPAN_FILL */
+  u8g2_draw_line(u8g2, NULL, x1, y1, x2, y2);
+}
+
@@ -50,6 +50,7 @@
 
 #include "../u8g2Headers/u8g2.h"
 #include <assert.h>
+#include <string.h>
 
 /*=================================================*/
 /*
@@ -58,6 +59,46 @@
     UC1701    
 */
 
+#ifdef U8G2_WITH_DIRTY_TILES
+/*
+  mark the tiles covered by a line, same arguments as u8g2_ll_hvline_vertical_top_lsb
+  the masks are built with unsigned arithmetic, so (2<<31) wrapping to 0 is fine
+*/
+static void u8g2_mark_dirty_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
+{
+  uint16_t last;
+  uint8_t row;
+  uint8_t last_row;
+  uint32_t mask;
+  
+  row = y >> 3;
+  if ( dir == 0 )
+  {
+    last = x;
+    last += len - 1;
+    last >>= 3;
+    mask = ((uint32_t)2 << last) - ((uint32_t)1 << (x >> 3));
+    last_row = row;
+  }
+  else
+  {
+    mask = (uint32_t)1 << (x >> 3);
+    last = y;
+    last += len - 1;
+    last_row = last >> 3;
+  }
+  
+  do
+  {
+#ifdef __unix
+    assert(row < U8G2_DIRTY_TILE_ROWS);
+#endif
+    u8g2->dirty_tiles[row] |= mask;
+    row++;
+  } while( row <= last_row );
+}
+#endif /* U8G2_WITH_DIRTY_TILES */
+
 
 #ifdef U8G2_WITH_HVLINE_SPEED_OPTIMIZATION
 
@@ -84,6 +125,10 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
   //assert(y >= u8g2->buf_y0);
   //assert(y < u8g2_GetU8x8(u8g2)->display_info->tile_height*8);
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_mark_dirty_vertical_top_lsb(u8g2, x, y, len, dir);
+#endif /* U8G2_WITH_DIRTY_TILES */
+
   /* bytes are vertical, lsb on top (y=0), msb at bottom (y=7) */
   bit_pos = y;		/* overflow truncate is ok here... */
   bit_pos &= 7; 	/* ... because only the lowest 3 bits are needed */
@@ -200,6 +245,9 @@ static void u8g2_draw_pixel_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_u
 */
 void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir)
 {
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_mark_dirty_vertical_top_lsb(u8g2, x, y, len, dir);
+#endif /* U8G2_WITH_DIRTY_TILES */
   if ( dir == 0 )
   {
     do
@@ -223,6 +271,87 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 
 #endif /* U8G2_WITH_HVLINE_SPEED_OPTIMIZATION */
 
+#if defined(U8G2_WITH_BOX_FILL) || defined(U8G2_WITH_SPAN_FILL)
+/*
+  x,y		first column and a row of the page within the local buffer (not the display!)
+  w		number of columns, must not be 0
+  mask		rows of the page to draw, bit 0 is the top row
+  asumption: 
+    all clipping done
+
+  The mask is the same for all columns, so it is applied to the bytes one
+  after the other. If it covers the whole page, the bytes are simply
+  overwritten with memset() for draw color 0 and 1, which stores whole words.
+*/
+void u8g2_ll_span_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, uint8_t mask)
+{
+  uint8_t *ptr;
+  uint8_t color = u8g2->draw_color;
+  
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_mark_dirty_vertical_top_lsb(u8g2, x, y, w, 0);
+#endif /* U8G2_WITH_DIRTY_TILES */
+  
+  ptr = u8g2->tile_buf_ptr;
+  ptr += (uint16_t)(y >> 3) * u8g2->pixel_buf_width;
+  ptr += x;
+  
+  if ( mask == 0x0ff && color <= 1 )
+  {
+    memset(ptr, color ? 0x0ff : 0, w);
+  }
+  else if ( color == 0 )
+  {
+    mask = ~mask;
+    do { *ptr++ &= mask; } while( --w != 0 );
+  }
+  else if ( color == 1 )
+  {
+    do { *ptr++ |= mask; } while( --w != 0 );
+  }
+  else
+  {
+    do { *ptr++ ^= mask; } while( --w != 0 );
+  }
+}
+#endif
+
+#ifdef U8G2_WITH_BOX_FILL
+/*
+  x,y		Upper left corner of the box within the local buffer (not the display!)
+  w,h		size of the box in pixel, w and h must not be 0
+  asumption: 
+    all clipping done
+
+  A box covers a run of pages. Only the first and the last page need a mask,
+  every page in between is covered completely and written as a whole.
+*/
+void u8g2_ll_box_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h)
+{
+  uint16_t last;
+  uint8_t mask, last_mask;
+  uint8_t pages;
+  
+  last = y;
+  last += h - 1;
+  mask = 0x0ff << (y & 7);
+  last_mask = 0x0ff >> (7 - (last & 7));
+  pages = (last >> 3) - (y >> 3);		/* pages after the first one */
+  
+  for(;;)
+  {
+    if ( pages == 0 )
+      mask &= last_mask;
+    u8g2_ll_span_vertical_top_lsb(u8g2, x, y, w, mask);
+    if ( pages == 0 )
+      break;
+    pages--;
+    y += 8;
+    mask = 0x0ff;
+  }
+}
+#endif /* U8G2_WITH_BOX_FILL */
+
 /*=================================================*/
 /*
   u8g2_ll_hvline_horizontal_right_lsb
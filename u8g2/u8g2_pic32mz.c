@@ -24,10 +24,7 @@ uint8_t u8x8_pic32_gpio_and_delay(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, vo
 		/* ms Delay */
 		//__delay_ms(arg_int);
 		break;
-	case U8X8_MSG_GPIO_CS:
-		/* Insert codes for SS pin control */      
-        //SS_PIN = arg_int;		
-		break;
+	/* no U8X8_MSG_GPIO_CS: SPIBus drives CS (RA0) for every transaction */
 	case U8X8_MSG_GPIO_DC:
 		/* Insert codes for DC pin control */
         DC_PIN = arg_int;		
@@ -45,27 +42,52 @@ uint8_t u8x8_byte_pic32_hw_spi(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void
 	switch(msg) {
 	case U8X8_MSG_BYTE_SEND:
 		/* Insert codes to transmit data */
-        SPI_TxBuffer(arg_ptr, arg_int);
+        /* between SPI_QueueBegin and SPI_QueueStart the bytes are collected
+           into SPIBus transactions, sent back to back from the SPI1 TX
+           interrupt once SPI_QueueStart hands them to the bus. Other bytes
+           go out as a transaction of their own, waited for */
+        if (SPI_IsQueueing())
+            SPI_QueueBytes(arg_ptr, arg_int);
+        else
+            SPI_TxBuffer(arg_ptr, arg_int);
 		break;
 	case U8X8_MSG_BYTE_INIT:
 		/* Insert codes to begin SPI transmission */
 		break;
 	case U8X8_MSG_BYTE_SET_DC:
 		/* Control DC pin, U8X8_MSG_GPIO_DC will be called */
-		u8x8_gpio_SetDC(u8x8, arg_int);
+        /* a queued transfer switches DC itself between segments */
+        if (SPI_IsQueueing())
+            SPI_QueueSetDC(arg_int);
+        else
+            u8x8_gpio_SetDC(u8x8, arg_int);
 		break;
 	case U8X8_MSG_BYTE_START_TRANSFER:
-		/* Select slave, U8X8_MSG_GPIO_CS will be called */
-		u8x8_gpio_SetCS(u8x8, u8x8->display_info->chip_enable_level);
-		//__delay_ms(1);
-		break;
 	case U8X8_MSG_BYTE_END_TRANSFER:
-		//__delay_ms(1);
-		/* Insert codes to end SPI transmission */
-		u8x8_gpio_SetCS(u8x8, u8x8->display_info->chip_disable_level);
+		/* nothing to do, SPIBus selects the display for each transaction
+		   and releases it when the transaction is out */
 		break;
 	default:
 		return 0;
 	}
 	return 1;
 }
+
+#ifdef U8X8_WITH_FIXED_SSD1306_SPI
+/* window commands and tile data of u8x8_d_ssd1306_DrawWindow(), the same as
+   U8X8_MSG_BYTE_SET_DC and U8X8_MSG_BYTE_SEND above. SPIBus selects the
+   display for each transfer, so there is no CS to handle here either */
+void u8x8_byte_DirectSend(u8x8_t *u8x8, uint8_t dc, uint8_t cnt, uint8_t *data)
+{
+    if (SPI_IsQueueing())
+    {
+        SPI_QueueSetDC(dc);
+        SPI_QueueBytes(data, cnt);
+    }
+    else
+    {
+        DC_PIN = dc;
+        SPI_TxBuffer(data, cnt);
+    }
+}
+#endif
@@ -58,6 +58,7 @@ struct _pg_struct
   uint8_t is_min_y_not_flat;
   pg_word_t total_scan_line_cnt;
   struct pg_edge_struct pge[2];	/* left and right line draw structures */
+  u8g2_span_t *span;		/* if not NULL, the lines are added to it instead of drawn */
 };
 
 
@@ -214,6 +215,18 @@ static void pg_hline(pg_struct *pg, u8g2_t *u8g2)
   x2 = pg->pge[PG_RIGHT].current_x;
   y = pg->pge[PG_RIGHT].current_y;
   
+#ifdef U8G2_WITH_SPAN_FILL
+  if ( pg->span != NULL )
+  {
+    /* u8g2_FillSpans() clips */
+    if ( x1 < x2 )
+      u8g2_AddSpan(pg->span, x1, x2, y);
+    else
+      u8g2_AddSpan(pg->span, x2, x1, y);
+    return;
+  }
+#endif /* U8G2_WITH_SPAN_FILL */
+  
   if ( y < 0 )
     return;
   if ( y >= u8g2_GetDisplayHeight(u8g2) )  // does not work for 256x64 display???
@@ -280,6 +293,11 @@ static void pg_exec(pg_struct *pg, u8g2_t *u8g2)
 
   do
   {
+#ifdef U8G2_WITH_SPAN_FILL
+    /* no more lines in the page */
+    if ( pg->span != NULL && pg->pge[PG_RIGHT].current_y >= pg->span->y1 )
+      break;
+#endif /* U8G2_WITH_SPAN_FILL */
     pg_hline(pg, u8g2);
     while ( pge_Next(&(pg->pge[PG_LEFT])) == 0 )
     {
@@ -311,8 +329,40 @@ static void pg_AddPolygonXY(pg_struct *pg, int16_t x, int16_t y)
   }
 }
 
+#ifdef U8G2_WITH_SPAN_FILL
+/* the lines of the polygon are walked again for each page */
+static void pg_spans(u8g2_t *u8g2, u8g2_span_t *span, void *shape)
+{
+  pg_struct *pg = (pg_struct *)shape;
+  
+  pg->span = span;
+  if ( pg_prepare(pg) != 0 )
+    pg_exec(pg, u8g2);
+}
+#endif /* U8G2_WITH_SPAN_FILL */
+
 static void pg_DrawPolygon(pg_struct *pg, u8g2_t *u8g2)
 {
+#ifdef U8G2_WITH_SPAN_FILL
+  pg_word_t min_y, max_y;
+  uint8_t i;
+  
+  if ( pg->cnt == 0 )
+    return;
+  min_y = pg->list[0].y;
+  max_y = pg->list[0].y;
+  for( i = 1; i < pg->cnt; i++ )
+  {
+    if ( min_y > pg->list[i].y )
+      min_y = pg->list[i].y;
+    if ( max_y < pg->list[i].y )
+      max_y = pg->list[i].y;
+  }
+  if ( u8g2_FillSpans(u8g2, min_y, max_y + 1, pg_spans, pg) != 0 )
+    return;
+#endif /* U8G2_WITH_SPAN_FILL */
+  
+  pg->span = NULL;
   if ( pg_prepare(pg) == 0 )
     return;
   pg_exec(pg, u8g2);
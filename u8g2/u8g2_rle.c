@@ -0,0 +1,120 @@
+/*
+
+  u8g2_rle.c
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Copyright (c) 2016, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+  Run length coded full screen frames.
+
+  A frame holds bytes of a full buffer (u8g2_GetBufferPtr(), page after
+  page, one byte per column), for the whole display or for the pages which
+  differ from the frame before it. It starts with two bytes, the first page
+  and the number of pages it covers, followed by codes which walk through
+  the bytes of those pages:
+
+    00nnnnnn	the next n+1 bytes
+    01nnnnnn	the next byte, n+1 times
+    10nnnnnn	n+1 bytes are left as they are
+    11nnnnnn	(n+1)*64 bytes are left as they are
+
+  A frame without skips replaces its pages. A frame with skips is a delta
+  and has to be drawn over the frame before it, so an animation is its
+  first frame followed by deltas. Frames are made from PBM images by
+  Tools/RleGen.
+
+*/
+
+#include "../u8g2Headers/u8g2.h"
+
+/*
+  Description:
+    Draw a run length coded frame into the buffer. In page mode only the
+    bytes of the current page are written, frames which do not cover it are
+    skipped without decoding. With U8G2_WITH_DIRTY_TILES only tiles whose
+    bytes really change are marked, so a delta marks just what it changes.
+  Args:
+    rle:	a frame made by Tools/RleGen for the size of the display
+*/
+void u8g2_DrawRleFrame(u8g2_t *u8g2, const uint8_t *rle)
+{
+  uint8_t *buf = u8g2->tile_buf_ptr;
+  uint16_t w = u8g2_GetU8x8(u8g2)->display_info->tile_width * 8;
+  uint16_t buf_start = (uint16_t)u8g2->tile_curr_row * w;
+  uint16_t buf_end = buf_start + (uint16_t)u8g2->tile_buf_height * w;
+  uint16_t pos = (uint16_t)rle[0] * w;
+  uint16_t end = pos + (uint16_t)rle[1] * w;
+  uint16_t n;
+  uint8_t code;
+  uint8_t v;
+  uint8_t is_run;
+  
+  if ( end > buf_end )
+    end = buf_end;
+  rle += 2;
+  while( pos < end )
+  {
+    code = *rle++;
+    n = (code & 0x03f) + 1;
+    if ( code >= 0x080 )
+    {
+      /* skip */
+      if ( code >= 0x0c0 )
+	n *= 64;
+      pos += n;
+      continue;
+    }
+    is_run = code >= 0x040;
+    if ( pos + n <= buf_start )
+    {
+      /* all of it before the current page */
+      rle += is_run ? 1 : n;
+      pos += n;
+      continue;
+    }
+    v = *rle;
+    while( n > 0 )
+    {
+      if ( !is_run )
+	v = *rle++;
+      if ( pos >= buf_start && pos < buf_end && buf[pos - buf_start] != v )
+      {
+	buf[pos - buf_start] = v;
+#ifdef U8G2_WITH_DIRTY_TILES
+	u8g2->dirty_tiles[(pos - buf_start) / w] |= (uint32_t)1 << (((pos - buf_start) % w) >> 3);
+#endif /* U8G2_WITH_DIRTY_TILES */
+      }
+      pos++;
+      n--;
+    }
+    if ( is_run )
+      rle++;
+  }
+}
@@ -71,6 +71,13 @@ void u8g2_SetClipWindow(u8g2_t *u8g2, u8g2_uint_t clip_x0, u8g2_uint_t clip_y0,
 void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_draw_ll_hvline_cb ll_hvline_cb, const u8g2_cb_t *u8g2_cb)
 {
   u8g2->font = NULL;
+#ifdef U8G2_WITH_FONT_INDEX
+  u8g2->font_index = NULL;
+  u8g2->font_index_flags = 0;
+#endif /* U8G2_WITH_FONT_INDEX */
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2->glyph_cache = NULL;
+#endif /* U8G2_WITH_GLYPH_CACHE */
   //u8g2->kerning = NULL;
   //u8g2->get_kerning_cb = u8g2_GetNullKerning;
   
@@ -79,9 +86,16 @@ void u8g2_SetupBuffer(u8g2_t *u8g2, uint8_t *buf, uint8_t tile_buf_height, u8g2_
   
   u8g2->tile_buf_ptr = buf;
   u8g2->tile_buf_height = tile_buf_height;
+#ifdef U8G2_WITH_BACK_BUFFER
+  u8g2->back_buf_ptr = NULL;
+#endif /* U8G2_WITH_BACK_BUFFER */
   
   u8g2->tile_curr_row = 0;
   
+#ifdef U8G2_WITH_DIRTY_TILES
+  u8g2_MarkBufferDirty(u8g2);
+#endif /* U8G2_WITH_DIRTY_TILES */
+  
   u8g2->font_decode.is_transparent = 0; /* issue 443 */
   u8g2->bitmap_transparency = 0;
   
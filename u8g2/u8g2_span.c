@@ -0,0 +1,183 @@
+/*
+
+  u8g2_span.c
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Copyright (c) 2016, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without
+  modification, are permitted provided that the following conditions are
+  met:
+
+  * Redistributions of source code must retain the above copyright
+    notice, this list of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright
+    notice, this list of conditions and the following disclaimer in the
+    documentation and/or other materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+  Filled shapes, drawn as spans of rows.
+
+  A shape which has at most one run of pixels in each row (disc, ellipse,
+  convex polygon, line) is given by a callback which adds these runs with
+  u8g2_AddSpan(), or for several rows at once with u8g2_AddSpans().
+  u8g2_FillSpans() clips the rows of the shape against the visible window
+  once, then calls the callback for each page the shape covers and keeps
+  only the rows of that page. The eight rows of a page are written
+  together: wherever the set of rows covering a column changes, a new run
+  of columns starts, and the run is written as one byte mask with
+  u8g2_ll_span_vertical_top_lsb(). The cost is the number of bytes
+  covered, plus walking the outline of the shape once per page.
+
+*/
+
+#include "../u8g2Headers/u8g2.h"
+#include <string.h>
+
+#ifdef U8G2_WITH_SPAN_FILL
+
+#define U8G2_SPAN_END 0x7fff
+
+/*
+  Description:
+    Add the columns x0 to x1-1 to the rows y0 to y1-1 of the page being
+    collected. Rows which are not visible in this page are ignored. If a
+    row gets more than one run, it keeps the smallest span covering all of
+    them.
+*/
+void u8g2_AddSpans(u8g2_span_t *span, int16_t x0, int16_t x1,
+  int16_t y0, int16_t y1)
+{
+  uint8_t r;
+  
+  if ( x0 >= x1 )
+    return;
+  if ( y0 < span->y0 )
+    y0 = span->y0;
+  if ( y1 > span->y1 )
+    y1 = span->y1;
+  for( ; y0 < y1; y0++ )
+  {
+    r = y0 - span->y;
+    if ( span->x1[r] <= span->x0[r] )
+    {
+      span->x0[r] = x0;
+      span->x1[r] = x1;
+      continue;
+    }
+    if ( span->x0[r] > x0 )
+      span->x0[r] = x0;
+    if ( span->x1[r] < x1 )
+      span->x1[r] = x1;
+  }
+}
+
+/*
+  Description:
+    Add the columns x0 to x1-1 of row y, see u8g2_AddSpans().
+*/
+void u8g2_AddSpan(u8g2_span_t *span, int16_t x0, int16_t x1, int16_t y)
+{
+  u8g2_AddSpans(span, x0, x1, y, y + 1);
+}
+
+/*
+  Description:
+    Clip the rows of the page against the window and write them, from one
+    end of a span to the next, with the mask of the rows covering each run.
+*/
+static void u8g2_write_span_page(u8g2_t *u8g2, u8g2_span_t *span)
+{
+  int16_t x, next;
+  uint8_t r;
+  uint8_t mask;
+  
+  x = U8G2_SPAN_END;
+  for( r = 0; r < 8; r++ )
+  {
+    if ( span->x0[r] < (int16_t)u8g2->user_x0 )
+      span->x0[r] = u8g2->user_x0;
+    if ( span->x1[r] > (int16_t)u8g2->user_x1 )
+      span->x1[r] = u8g2->user_x1;
+    if ( span->x0[r] < span->x1[r] && x > span->x0[r] )
+      x = span->x0[r];
+  }
+  
+  while( x != U8G2_SPAN_END )
+  {
+    mask = 0;
+    next = U8G2_SPAN_END;
+    for( r = 0; r < 8; r++ )
+    {
+      if ( span->x0[r] >= span->x1[r] )
+	continue;
+      if ( span->x0[r] <= x && x < span->x1[r] )
+	mask |= 1 << r;
+      if ( span->x0[r] > x && next > span->x0[r] )
+	next = span->x0[r];
+      if ( span->x1[r] > x && next > span->x1[r] )
+	next = span->x1[r];
+    }
+    if ( mask != 0 )
+      u8g2_ll_span_vertical_top_lsb(u8g2, x, span->y - u8g2->pixel_curr_row,
+	next - x, mask);
+    x = next;
+  }
+}
+
+/*
+  Description:
+    Fill a shape given by its rows. The callback is called once for each
+    visible page of the rows y0 to y1-1 and adds the runs of the shape with
+    u8g2_AddSpan() or u8g2_AddSpans(). It may simply add all of them every
+    time, only the rows of the current page are kept.
+  Args:
+    y0, y1:	first row of the shape and the row after the last one
+    rows:	callback which adds the runs of the shape
+    shape:	passed to the callback
+  Return:
+    0 if the shape has to be drawn line by line: rotated display or other
+    buffer layout
+*/
+uint8_t u8g2_FillSpans(u8g2_t *u8g2, int16_t y0, int16_t y1,
+  u8g2_span_rows_cb rows, void *shape)
+{
+  u8g2_span_t span;
+  
+  if ( u8g2_IsPageBlitBuffer(u8g2) == 0 )
+    return 0;
+  if ( y0 < (int16_t)u8g2->user_y0 )
+    y0 = u8g2->user_y0;
+  if ( y1 > (int16_t)u8g2->user_y1 )
+    y1 = u8g2->user_y1;
+  
+  for( span.y = y0 & ~7; span.y < y1; span.y += 8 )
+  {
+    span.y0 = span.y < y0 ? y0 : span.y;
+    span.y1 = span.y + 8 > y1 ? y1 : span.y + 8;
+    memset(span.x0, 0, sizeof(span.x0));
+    memset(span.x1, 0, sizeof(span.x1));
+    rows(u8g2, &span, shape);
+    u8g2_write_span_page(u8g2, &span);
+  }
+  return 1;
+}
+
+#endif /* U8G2_WITH_SPAN_FILL */
@@ -36,6 +36,7 @@
 */
 
 #include "../u8g2Headers/u8x8.h"
+#include <string.h>
 
 #if defined(ESP8266)
 uint8_t u8x8_pgm_read_esp(const uint8_t * addr) 
@@ -468,6 +469,55 @@ uint8_t u8x8_Draw1x2UTF8(u8x8_t *u8x8, uint8_t x, uint8_t y, const char *s)
 
 
 
+/*
+  Render one glyph of the current font into memory. The glyph is th x tv
+  tiles, "buf" points to its top left tile and rows of tiles are "stride"
+  bytes apart.
+*/
+void u8x8_RenderGlyph(u8x8_t *u8x8, uint8_t *buf, uint16_t stride, uint8_t encoding)
+{
+  uint8_t th = u8x8_pgm_read(u8x8->font+2);		/* new 2019 format */
+  uint8_t tv = u8x8_pgm_read(u8x8->font+3);	/* new 2019 format */
+  uint8_t xx, yy, tile;
+  
+  tile = 0;
+  for( yy = 0; yy < tv; yy++ )
+    for( xx = 0; xx < th; xx++ )
+      u8x8_get_glyph_data(u8x8, encoding, buf + yy*stride + xx*8, tile++);
+}
+
+/*
+  Render a string into memory instead of drawing it. "buf" holds tv rows of
+  "cnt" tiles each, one row after the other, where tv is the tile height of
+  the current font. Glyphs which do not fit are dropped, tiles behind the
+  last glyph are cleared (inverted in font inverse mode). The buffer can
+  then go to the display in one piece:
+    u8x8_DrawWindow(u8x8, x, y, cnt, tv, buf, cnt*8)
+  Returns the number of glyphs rendered.
+*/
+uint8_t u8x8_RenderString(u8x8_t *u8x8, uint8_t *buf, uint8_t cnt, const char *s)
+{
+  uint8_t th = u8x8_pgm_read(u8x8->font+2);		/* new 2019 format */
+  uint8_t tv = u8x8_pgm_read(u8x8->font+3);	/* new 2019 format */
+  uint16_t stride = cnt*8;
+  uint8_t x = 0;
+  uint8_t glyphs = 0;
+  uint8_t yy;
+  
+  for(;;)
+  {
+    if ( *s == '\0' || x + th > cnt )
+      break;
+    u8x8_RenderGlyph(u8x8, buf + x*8, stride, (uint8_t)*s);
+    s++;
+    x += th;
+    glyphs++;
+  }
+  for( yy = 0; yy < tv; yy++ )
+    memset(buf + yy*stride + x*8, u8x8->is_font_inverse_mode ? 255 : 0, (cnt - x)*8);
+  return glyphs;
+}
+
 uint8_t u8x8_GetUTF8Len(u8x8_t *u8x8, const char *s)
 {
   uint16_t e;
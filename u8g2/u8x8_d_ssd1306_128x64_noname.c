@@ -50,7 +50,7 @@ static const uint8_t u8x8_d_ssd1306_128x64_noname_init_seq[] = {
   U8X8_CA(0x0d3, 0x000),		/* display offset */
   U8X8_C(0x040),		                /* set display start line to 0 */
   U8X8_CA(0x08d, 0x014),		/* [2] charge pump setting (p62): 0x014 enable, 0x010 disable, SSD1306 only, should be removed for SH1106 */
-  U8X8_CA(0x020, 0x000),		/* page addressing mode */
+  U8X8_CA(0x020, 0x000),		/* horizontal addressing mode, 0x002 would be page addressing mode */
   
   U8X8_C(0x0a1),				/* segment remap a0/a1*/
   U8X8_C(0x0c8),				/* c0: scan dir normal, c8: reverse */
@@ -87,7 +87,7 @@ static const uint8_t u8x8_d_ssd1306_128x64_vcomh0_init_seq[] = {
   U8X8_CA(0x0d3, 0x000),		/* display offset */
   U8X8_C(0x040),		                /* set display start line to 0 */
   U8X8_CA(0x08d, 0x014),		/* [2] charge pump setting (p62): 0x014 enable, 0x010 disable */
-  U8X8_CA(0x020, 0x000),		/* page addressing mode */
+  U8X8_CA(0x020, 0x000),		/* horizontal addressing mode, 0x002 would be page addressing mode */
   
   U8X8_C(0x0a1),				/* segment remap a0/a1*/
   U8X8_C(0x0c8),				/* c0: scan dir normal, c8: reverse */
@@ -123,7 +123,7 @@ static const uint8_t u8x8_d_ssd1306_128x64_alt0_init_seq[] = {
   U8X8_CA(0x0d3, 0x000),		/* display offset */
   U8X8_C(0x040),		                /* set display start line to 0 */
   U8X8_CA(0x08d, 0x014),		/* [2] charge pump setting (p62): 0x014 enable, 0x010 disable, SSD1306 only, should be removed for SH1106 */
-  U8X8_CA(0x020, 0x000),		/* page addressing mode */
+  U8X8_CA(0x020, 0x000),		/* horizontal addressing mode, 0x002 would be page addressing mode */
   
   U8X8_C(0x0a1),				/* segment remap a0/a1*/
   U8X8_C(0x0c8),				/* c0: scan dir normal, c8: reverse */
@@ -204,6 +204,100 @@ static const uint8_t u8x8_d_ssd1306_128x64_noname_flip1_seq[] = {
 };
 
 
+/*
+  SSD1306 only, the SH1106 has no horizontal addressing mode.
+  The init sequence selects horizontal addressing mode: once the column
+  and page window is set (which also moves the RAM pointer to its top left
+  corner) the controller fills the window row by row from one stream of
+  data bytes. Tiles are drawn the same way, as a window one tile row high,
+  so the window is always set before data is written and no page
+  addressing commands are mixed in.
+*/
+static void u8x8_d_ssd1306_set_window(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+  x *= 8;
+  x += u8x8->x_offset;
+  u8x8_cad_SendCmd(u8x8, 0x021 );	/* column window */
+  u8x8_cad_SendArg(u8x8, x );
+  u8x8_cad_SendArg(u8x8, x + w*8 - 1 );
+  u8x8_cad_SendCmd(u8x8, 0x022 );	/* page window */
+  u8x8_cad_SendArg(u8x8, y );
+  u8x8_cad_SendArg(u8x8, y + h - 1 );
+}
+
+#ifdef U8X8_WITH_FIXED_SSD1306_SPI
+/*
+  Description:
+    Send a window of tiles straight to u8x8_byte_DirectSend(), see
+    U8X8_WITH_FIXED_SSD1306_SPI: the window commands as one command transfer,
+    then each row of tiles as one data transfer. Rows which follow each other
+    in memory can still be merged by the byte layer.
+  Args:
+    x, y, w, h: the window in tiles, w*8 must not exceed 255
+    tile_ptr: the first row of w*8 column bytes
+    stride: bytes from one row to the next
+*/
+void u8x8_d_ssd1306_DrawWindow(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *tile_ptr, uint16_t stride)
+{
+  uint8_t cmd[6];
+  
+  x *= 8;
+  x += u8x8->x_offset;
+  cmd[0] = 0x021;		/* column window */
+  cmd[1] = x;
+  cmd[2] = x + w*8 - 1;
+  cmd[3] = 0x022;		/* page window */
+  cmd[4] = y;
+  cmd[5] = y + h - 1;
+  u8x8_byte_DirectSend(u8x8, 0, sizeof(cmd), cmd);
+  do
+  {
+    u8x8_byte_DirectSend(u8x8, 1, w*8, tile_ptr);
+    tile_ptr += stride;
+    h--;
+  } while( h > 0 );
+}
+#endif
+
+static uint8_t u8x8_d_ssd1306_draw(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
+{
+  uint8_t c, h;
+  uint8_t *ptr;
+  switch(msg)
+  {
+    case U8X8_MSG_DISPLAY_DRAW_TILE:
+      c = ((u8x8_tile_t *)arg_ptr)->cnt;
+      ptr = ((u8x8_tile_t *)arg_ptr)->tile_ptr;
+      u8x8_cad_StartTransfer(u8x8);
+      u8x8_d_ssd1306_set_window(u8x8, ((u8x8_tile_t *)arg_ptr)->x_pos, ((u8x8_tile_t *)arg_ptr)->y_pos, c*arg_int, 1);
+      do
+      {
+	u8x8_cad_SendData(u8x8, c*8, ptr);
+	arg_int--;
+      } while( arg_int > 0 );
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    case U8X8_MSG_DISPLAY_DRAW_WINDOW:
+      c = ((u8x8_window_t *)arg_ptr)->w;
+      h = ((u8x8_window_t *)arg_ptr)->h;
+      ptr = ((u8x8_window_t *)arg_ptr)->tile_ptr;
+      u8x8_cad_StartTransfer(u8x8);
+      u8x8_d_ssd1306_set_window(u8x8, ((u8x8_window_t *)arg_ptr)->x_pos, ((u8x8_window_t *)arg_ptr)->y_pos, c, h);
+      /* rows which follow each other in memory reach the byte layer back to back, so it can send them as one transfer */
+      do
+      {
+	u8x8_cad_SendData(u8x8, c*8, ptr);
+	ptr += ((u8x8_window_t *)arg_ptr)->stride;
+	h--;
+      } while( h > 0 );
+      u8x8_cad_EndTransfer(u8x8);
+      break;
+    default:
+      return 0;
+  }
+  return 1;
+}
+
 static uint8_t u8x8_d_ssd1306_sh1106_generic(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
   uint8_t x, c;
@@ -312,6 +406,8 @@ static const u8x8_display_info_t u8x8_ssd1306_128x64_noname_display_info =
 uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
     
+  if ( u8x8_d_ssd1306_draw(u8x8, msg, arg_int, arg_ptr) != 0 )
+    return 1;
   if ( u8x8_d_ssd1306_sh1106_generic(u8x8, msg, arg_int, arg_ptr) != 0 )
     return 1;
   
@@ -333,6 +429,8 @@ uint8_t u8x8_d_ssd1306_128x64_noname(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
 uint8_t u8x8_d_ssd1306_128x64_vcomh0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
     
+  if ( u8x8_d_ssd1306_draw(u8x8, msg, arg_int, arg_ptr) != 0 )
+    return 1;
   if ( u8x8_d_ssd1306_sh1106_generic(u8x8, msg, arg_int, arg_ptr) != 0 )
     return 1;
   
@@ -354,6 +452,8 @@ uint8_t u8x8_d_ssd1306_128x64_vcomh0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int,
 uint8_t u8x8_d_ssd1306_128x64_alt0(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr)
 {
   
+  if ( u8x8_d_ssd1306_draw(u8x8, msg, arg_int, arg_ptr) != 0 )
+    return 1;
   if ( u8x8_d_ssd1306_sh1106_generic(u8x8, msg, arg_int, arg_ptr) != 0 )
     return 1;
   
@@ -81,12 +81,34 @@ void u8x8_d_helper_display_init(u8x8_t *u8x8)
 
 uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr)
 {
+#ifdef U8X8_WITH_FIXED_SSD1306_SPI
+  u8x8_d_ssd1306_DrawWindow(u8x8, x, y, cnt, 1, tile_ptr, cnt*8);
+  return 1;
+#else
   u8x8_tile_t tile;
   tile.x_pos = x;
   tile.y_pos = y;
   tile.cnt = cnt;
   tile.tile_ptr = tile_ptr;
   return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_TILE, 1, (void *)&tile);
+#endif
+}
+
+uint8_t u8x8_DrawWindow(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *tile_ptr, uint16_t stride)
+{
+#ifdef U8X8_WITH_FIXED_SSD1306_SPI
+  u8x8_d_ssd1306_DrawWindow(u8x8, x, y, w, h, tile_ptr, stride);
+  return 1;
+#else
+  u8x8_window_t window;
+  window.tile_ptr = tile_ptr;
+  window.stride = stride;
+  window.x_pos = x;
+  window.y_pos = y;
+  window.w = w;
+  window.h = h;
+  return u8x8->display_cb(u8x8, U8X8_MSG_DISPLAY_DRAW_WINDOW, 0, (void *)&window);
+#endif
 }
 
 /* should be implemented as macro */
@@ -2,6 +2,61 @@
   u8x8_fonts.c
 */
 #include "../u8g2Headers/u8x8.h"
+/*
+  Fontname: -Misc-Fixed-Medium-R-Normal--14-130-75-75-C-70-ISO10646-1
+  Copyright: Public domain font.  Share and enjoy.
+  Glyphs: 95/2576
+  BBX Build Mode: 3
+*/
+const uint8_t u8x8_font_7x14_1x2_r[1524] U8X8_FONT_SECTION("u8x8_font_7x14_1x2_r") = 
+  " ~\1\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\0\0\0\0\0\0\0"
+  "\33\0\0\0\0\0\0<\0<\0\0\0\0\0\0\0\0\0\0\0\0@\370@\370@\0\0\0\2\37"
+  "\2\37\2\0\0`\220\20\370\20`\0\0\14\20\21\77\21\16\0\0\60HH\360 \30\0\0\30\4\17"
+  "\22\22\14\0\0\0p\210\210p\0\0\0\16\21\21\12\14\23\0\0\0\0\0<\0\0\0\0\0\0\0"
+  "\0\0\0\0\0\0\0\300\60\10\4\0\0\0\0\7\30 @\0\0\0\4\10\60\300\0\0\0\0@ "
+  "\30\7\0\0\0\0@\200\340\200@\0\0\0\4\2\17\2\4\0\0\0\0\0\340\0\0\0\0\0\1\1"
+  "\17\1\1\0\0\0\0\0\0\0\0\0\0\0\0H\70\0\0\0\0\0\0\0\0\0\0\0\0\0\1\1"
+  "\1\1\1\0\0\0\0\0\0\0\0\0\0\0\0\20\70\20\0\0\0\0\0\0\300\60\14\0\0`\30\6"
+  "\1\0\0\0\0\340\20\10\10\20\340\0\0\7\10\20\20\10\7\0\0\0 \20\370\0\0\0\0\0\20\20"
+  "\37\20\20\0\0\60\10\10\10\210p\0\0\20\30\24\22\21\20\0\0\10\10\210\310\250\30\0\0\14\20\20"
+  "\20\20\17\0\0\0\200`\20\370\0\0\0\6\5\4\4\37\4\0\0\370HHHH\210\0\0\14\20\20"
+  "\20\20\17\0\0\340\20\210\210\210\0\0\0\17\21\20\20\20\17\0\0\10\10\10\210h\30\0\0\0\30\6"
+  "\1\0\0\0\0\60H\210\210H\60\0\0\16\21\20\20\21\16\0\0\360\10\10\10\210\360\0\0\14\21\21"
+  "\21\10\7\0\0\0\0@\340@\0\0\0\0\0\10\34\10\0\0\0\0\0\300\300\0\0\0\0\0\0$"
+  "\34\0\0\0\0\0\0\200@ \20\0\0\0\1\2\4\10\20\0\0@@@@@@\0\0\2\2\2"
+  "\2\2\2\0\0\0\20 @\200\0\0\0\0\20\10\4\2\1\0\0\60\10\10\210H\60\0\0\0\0\0"
+  "\33\0\0\0\0\340\20\310((\360\0\0\7\10\23\24\24\27\0\0\340\20\10\10\20\340\0\0\37\1\1"
+  "\1\1\37\0\0\370\210\210\210P \0\0\37\20\20\20\11\6\0\0\360\10\10\10\10\60\0\0\17\20\20"
+  "\20\20\14\0\0\370\10\10\10\20\340\0\0\37\20\20\20\10\7\0\0\370\210\210\210\10\10\0\0\37\20\20"
+  "\20\20\20\0\0\370\210\210\210\10\10\0\0\37\0\0\0\0\0\0\0\360\10\10\10\10\60\0\0\17\20\20"
+  "\21\11\37\0\0\370\200\200\200\200\370\0\0\37\0\0\0\0\37\0\0\0\10\10\370\10\10\0\0\0\20\20"
+  "\37\20\20\0\0\0\0\0\10\370\10\0\0\14\20\20\20\17\0\0\0\370\200@ \20\10\0\0\37\0\1"
+  "\2\4\30\0\0\370\0\0\0\0\0\0\0\37\20\20\20\20\20\0\0\370\60\300\300\60\370\0\0\37\0\0"
+  "\0\0\37\0\0\370`\200\0\0\370\0\0\37\0\0\1\6\37\0\0\360\10\10\10\10\360\0\0\17\20\20"
+  "\20\20\17\0\0\370\10\10\10\10\360\0\0\37\1\1\1\1\0\0\0\360\10\10\10\10\360\0\0\17\22\22"
+  "\24\70O\0\0\370\10\10\10\10\360\0\0\37\1\1\3\5\30\0\0p\210\210\10\10\60\0\0\14\20\20"
+  "\21\21\16\0\0\10\10\10\370\10\10\10\0\0\0\0\37\0\0\0\0\370\0\0\0\0\370\0\0\17\20\20"
+  "\20\20\17\0\0x\200\0\0\200x\0\0\0\3\34\34\3\0\0\0\0\370\0\0\0\370\0\0\0\17\20"
+  "\16\20\17\0\0\30`\200\200`\30\0\0\30\6\1\1\6\30\0\0\0\70\300\0\300\70\0\0\0\0\0"
+  "\37\0\0\0\0\10\10\10\310(\30\0\0\30\26\21\20\20\20\0\0\0\0\374\4\4\4\0\0\0\0\177"
+  "@@@\0\0\14\60\300\0\0\0\0\0\0\0\1\6\30`\0\0\0\4\4\4\374\0\0\0\0@@"
+  "@\177\0\0\0\20\10\4\4\10\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0@@@"
+  "@@@\0\0\0\0\4\10\20\0\0\0\0\0\0\0\0\0\0\0\200@@@@\200\0\0\14\22\22"
+  "\22\22\37\0\0\370\200@@@\200\0\0\37\10\20\20\20\17\0\0\200@@@@\200\0\0\17\20\20"
+  "\20\20\10\0\0\200@@@\200\370\0\0\17\20\20\20\10\37\0\0\200@@@@\200\0\0\17\22\22"
+  "\22\22\13\0\0\200\200\360\210\210\20\0\0\0\0\37\0\0\0\0\0\200@@@\200@\0\0\63LT"
+  "TS \0\0\370\200@@@\200\0\0\37\0\0\0\0\37\0\0\0\0@\330\0\0\0\0\0\20\20"
+  "\37\20\20\0\0\0\0\0\0@\330\0\0\0\60@@@\77\0\0\370\0\0\200@\0\0\0\37\2\3"
+  "\4\10\20\0\0\0\0\10\370\0\0\0\0\0\20\20\37\20\20\0\0\0\300@\200@\200\0\0\0\37\0"
+  "\17\0\37\0\0\300\200@@@\200\0\0\37\0\0\0\0\37\0\0\200@@@@\200\0\0\17\20\20"
+  "\20\20\17\0\0\300\200@@@\200\0\0\177\10\20\20\20\17\0\0\200@@@\200\300\0\0\17\20\20"
+  "\20\10\177\0\0\300\200@@@\200\0\0\37\0\0\0\0\1\0\0\200@@@@\200\0\0\10\21\22"
+  "\22\24\10\0\0@@\370@@\0\0\0\0\0\17\20\20\10\0\0\300\0\0\0\0\300\0\0\17\20\20"
+  "\20\10\37\0\0\0\300\0\0\0\300\0\0\0\1\6\30\6\1\0\0\0\300\0\0\0\300\0\0\0\17\20"
+  "\17\20\17\0\0\300\0\0\0\0\300\0\0\30\5\2\2\5\30\0\0\300\0\0\0\0\300\0\0'HH"
+  "HD\77\0\0@@@@\300@\0\0\20\30\26\21\20\20\0\0\0\0\0\370\4\4\0\0\0\0\1"
+  ">@@\0\0\0\0\0\374\0\0\0\0\0\0\0\177\0\0\0\0\0\4\4\370\0\0\0\0\0@@"
+  ">\1\0\0\0\30\4\10\20 \30\0\0\0\0\0\0\0\0";
 #if 0
 /*
   Fontname: -FreeType-Amstrad CPC extended-Medium-R-Normal--8-80-72-72-P-64-ISO10646-1
@@ -866,61 +921,6 @@ const uint8_t u8x8_font_7x14_1x2_f[3588] U8X8_FONT_SECTION("u8x8_font_7x14_1x2_f
   "\20\10\37\0\0\300\20\0\0\20\300\0\0\17\20\20\20\10\37\0\0\300\0\20\10\0\300\0\0 CL"
   "\70\16\1\0\0\370\200@@@\200\0\0\177\10\20\20\20\17\0\0\300\20\0\0\20\300\0\0 CL"
   "\70\16\1";
-/*
-  Fontname: -Misc-Fixed-Medium-R-Normal--14-130-75-75-C-70-ISO10646-1
-  Copyright: Public domain font.  Share and enjoy.
-  Glyphs: 95/2576
-  BBX Build Mode: 3
-*/
-const uint8_t u8x8_font_7x14_1x2_r[1524] U8X8_FONT_SECTION("u8x8_font_7x14_1x2_r") = 
-  " ~\1\2\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\370\0\0\0\0\0\0\0"
-  "\33\0\0\0\0\0\0<\0<\0\0\0\0\0\0\0\0\0\0\0\0@\370@\370@\0\0\0\2\37"
-  "\2\37\2\0\0`\220\20\370\20`\0\0\14\20\21\77\21\16\0\0\60HH\360 \30\0\0\30\4\17"
-  "\22\22\14\0\0\0p\210\210p\0\0\0\16\21\21\12\14\23\0\0\0\0\0<\0\0\0\0\0\0\0"
-  "\0\0\0\0\0\0\0\300\60\10\4\0\0\0\0\7\30 @\0\0\0\4\10\60\300\0\0\0\0@ "
-  "\30\7\0\0\0\0@\200\340\200@\0\0\0\4\2\17\2\4\0\0\0\0\0\340\0\0\0\0\0\1\1"
-  "\17\1\1\0\0\0\0\0\0\0\0\0\0\0\0H\70\0\0\0\0\0\0\0\0\0\0\0\0\0\1\1"
-  "\1\1\1\0\0\0\0\0\0\0\0\0\0\0\0\20\70\20\0\0\0\0\0\0\300\60\14\0\0`\30\6"
-  "\1\0\0\0\0\340\20\10\10\20\340\0\0\7\10\20\20\10\7\0\0\0 \20\370\0\0\0\0\0\20\20"
-  "\37\20\20\0\0\60\10\10\10\210p\0\0\20\30\24\22\21\20\0\0\10\10\210\310\250\30\0\0\14\20\20"
-  "\20\20\17\0\0\0\200`\20\370\0\0\0\6\5\4\4\37\4\0\0\370HHHH\210\0\0\14\20\20"
-  "\20\20\17\0\0\340\20\210\210\210\0\0\0\17\21\20\20\20\17\0\0\10\10\10\210h\30\0\0\0\30\6"
-  "\1\0\0\0\0\60H\210\210H\60\0\0\16\21\20\20\21\16\0\0\360\10\10\10\210\360\0\0\14\21\21"
-  "\21\10\7\0\0\0\0@\340@\0\0\0\0\0\10\34\10\0\0\0\0\0\300\300\0\0\0\0\0\0$"
-  "\34\0\0\0\0\0\0\200@ \20\0\0\0\1\2\4\10\20\0\0@@@@@@\0\0\2\2\2"
-  "\2\2\2\0\0\0\20 @\200\0\0\0\0\20\10\4\2\1\0\0\60\10\10\210H\60\0\0\0\0\0"
-  "\33\0\0\0\0\340\20\310((\360\0\0\7\10\23\24\24\27\0\0\340\20\10\10\20\340\0\0\37\1\1"
-  "\1\1\37\0\0\370\210\210\210P \0\0\37\20\20\20\11\6\0\0\360\10\10\10\10\60\0\0\17\20\20"
-  "\20\20\14\0\0\370\10\10\10\20\340\0\0\37\20\20\20\10\7\0\0\370\210\210\210\10\10\0\0\37\20\20"
-  "\20\20\20\0\0\370\210\210\210\10\10\0\0\37\0\0\0\0\0\0\0\360\10\10\10\10\60\0\0\17\20\20"
-  "\21\11\37\0\0\370\200\200\200\200\370\0\0\37\0\0\0\0\37\0\0\0\10\10\370\10\10\0\0\0\20\20"
-  "\37\20\20\0\0\0\0\0\10\370\10\0\0\14\20\20\20\17\0\0\0\370\200@ \20\10\0\0\37\0\1"
-  "\2\4\30\0\0\370\0\0\0\0\0\0\0\37\20\20\20\20\20\0\0\370\60\300\300\60\370\0\0\37\0\0"
-  "\0\0\37\0\0\370`\200\0\0\370\0\0\37\0\0\1\6\37\0\0\360\10\10\10\10\360\0\0\17\20\20"
-  "\20\20\17\0\0\370\10\10\10\10\360\0\0\37\1\1\1\1\0\0\0\360\10\10\10\10\360\0\0\17\22\22"
-  "\24\70O\0\0\370\10\10\10\10\360\0\0\37\1\1\3\5\30\0\0p\210\210\10\10\60\0\0\14\20\20"
-  "\21\21\16\0\0\10\10\10\370\10\10\10\0\0\0\0\37\0\0\0\0\370\0\0\0\0\370\0\0\17\20\20"
-  "\20\20\17\0\0x\200\0\0\200x\0\0\0\3\34\34\3\0\0\0\0\370\0\0\0\370\0\0\0\17\20"
-  "\16\20\17\0\0\30`\200\200`\30\0\0\30\6\1\1\6\30\0\0\0\70\300\0\300\70\0\0\0\0\0"
-  "\37\0\0\0\0\10\10\10\310(\30\0\0\30\26\21\20\20\20\0\0\0\0\374\4\4\4\0\0\0\0\177"
-  "@@@\0\0\14\60\300\0\0\0\0\0\0\0\1\6\30`\0\0\0\4\4\4\374\0\0\0\0@@"
-  "@\177\0\0\0\20\10\4\4\10\20\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0\0@@@"
-  "@@@\0\0\0\0\4\10\20\0\0\0\0\0\0\0\0\0\0\0\200@@@@\200\0\0\14\22\22"
-  "\22\22\37\0\0\370\200@@@\200\0\0\37\10\20\20\20\17\0\0\200@@@@\200\0\0\17\20\20"
-  "\20\20\10\0\0\200@@@\200\370\0\0\17\20\20\20\10\37\0\0\200@@@@\200\0\0\17\22\22"
-  "\22\22\13\0\0\200\200\360\210\210\20\0\0\0\0\37\0\0\0\0\0\200@@@\200@\0\0\63LT"
-  "TS \0\0\370\200@@@\200\0\0\37\0\0\0\0\37\0\0\0\0@\330\0\0\0\0\0\20\20"
-  "\37\20\20\0\0\0\0\0\0@\330\0\0\0\60@@@\77\0\0\370\0\0\200@\0\0\0\37\2\3"
-  "\4\10\20\0\0\0\0\10\370\0\0\0\0\0\20\20\37\20\20\0\0\0\300@\200@\200\0\0\0\37\0"
-  "\17\0\37\0\0\300\200@@@\200\0\0\37\0\0\0\0\37\0\0\200@@@@\200\0\0\17\20\20"
-  "\20\20\17\0\0\300\200@@@\200\0\0\177\10\20\20\20\17\0\0\200@@@\200\300\0\0\17\20\20"
-  "\20\10\177\0\0\300\200@@@\200\0\0\37\0\0\0\0\1\0\0\200@@@@\200\0\0\10\21\22"
-  "\22\24\10\0\0@@\370@@\0\0\0\0\0\17\20\20\10\0\0\300\0\0\0\0\300\0\0\17\20\20"
-  "\20\10\37\0\0\0\300\0\0\0\300\0\0\0\1\6\30\6\1\0\0\0\300\0\0\0\300\0\0\0\17\20"
-  "\17\20\17\0\0\300\0\0\0\0\300\0\0\30\5\2\2\5\30\0\0\300\0\0\0\0\300\0\0'HH"
-  "HD\77\0\0@@@@\300@\0\0\20\30\26\21\20\20\0\0\0\0\0\370\4\4\0\0\0\0\1"
-  ">@@\0\0\0\0\0\374\0\0\0\0\0\0\0\177\0\0\0\0\0\4\4\370\0\0\0\0\0@@"
-  ">\1\0\0\0\30\4\10\20 \30\0\0\0\0\0\0\0\0";
 /*
   Fontname: -Misc-Fixed-Medium-R-Normal--14-130-75-75-C-70-ISO10646-1
   Copyright: Public domain font.  Share and enjoy.
@@ -0,0 +1,127 @@
+/*
+
+  u8x8_ssd1306_fx.c
+
+  Universal 8bit Graphics Library (https://github.com/olikraus/u8g2/)
+
+  Copyright (c) 2016, olikraus@gmail.com
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with or without modification,
+  are permitted provided that the following conditions are met:
+
+  * Redistributions of source code must retain the above copyright notice, this list
+    of conditions and the following disclaimer.
+
+  * Redistributions in binary form must reproduce the above copyright notice, this
+    list of conditions and the following disclaimer in the documentation and/or other
+    materials provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+  STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+  ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+  Visual effects done by the SSD1306 itself: continuous horizontal and
+  diagonal scrolling, the display start line, and inverted display.
+  Each call is a handful of command bytes; the display RAM is not touched.
+  Contrast is set with u8x8_SetContrast().
+
+  The commands are only valid for SSD1306 (and SSD1309) controllers.
+
+*/
+
+#include "../u8g2Headers/u8x8.h"
+
+/*
+  Description:
+    Start continuous scrolling of the pages start_page to end_page.
+  Args:
+    dir:		U8X8_SSD1306_SCROLL_RIGHT or U8X8_SSD1306_SCROLL_LEFT
+    start_page, end_page: 0..7, start_page <= end_page
+    interval:	one of the U8X8_SSD1306_SCROLL_FRAMES_x values
+    vertical_offset:	0 for horizontal scrolling, 1..63 for diagonal
+    			scrolling: the whole display also moves up by this
+    			many rows every step
+  Note:
+    The display RAM must not be written while the display scrolls: call
+    u8x8_ssd1306_StopScroll() before the next transfer of tiles.
+*/
+void u8x8_ssd1306_StartScroll(u8x8_t *u8x8, uint8_t dir, uint8_t start_page, uint8_t end_page, uint8_t interval, uint8_t vertical_offset)
+{
+  u8x8_cad_StartTransfer(u8x8);
+  u8x8_cad_SendCmd(u8x8, 0x02e);		/* parameters may only change while scrolling is off */
+  if ( vertical_offset == 0 )
+  {
+    u8x8_cad_SendCmd(u8x8, dir == U8X8_SSD1306_SCROLL_LEFT ? 0x027 : 0x026);
+  }
+  else
+  {
+    /* diagonal scrolling moves all rows of the display */
+    u8x8_cad_SendCmd(u8x8, 0x0a3);
+    u8x8_cad_SendArg(u8x8, 0);			/* no fixed rows at the top */
+    u8x8_cad_SendArg(u8x8, u8x8->display_info->tile_height*8);
+    u8x8_cad_SendCmd(u8x8, dir == U8X8_SSD1306_SCROLL_LEFT ? 0x02a : 0x029);
+  }
+  u8x8_cad_SendArg(u8x8, 0);			/* dummy byte */
+  u8x8_cad_SendArg(u8x8, start_page);
+  u8x8_cad_SendArg(u8x8, interval);
+  u8x8_cad_SendArg(u8x8, end_page);
+  if ( vertical_offset == 0 )
+  {
+    u8x8_cad_SendArg(u8x8, 0x000);		/* dummy bytes */
+    u8x8_cad_SendArg(u8x8, 0x0ff);
+  }
+  else
+  {
+    u8x8_cad_SendArg(u8x8, vertical_offset);
+  }
+  u8x8_cad_SendCmd(u8x8, 0x02f);		/* activate scroll */
+  u8x8_cad_EndTransfer(u8x8);
+}
+
+/*
+  Description:
+    Stop scrolling. The SSD1306 leaves the scrolled pages where they are
+    in its RAM, so they have to be transferred again afterwards.
+*/
+void u8x8_ssd1306_StopScroll(u8x8_t *u8x8)
+{
+  u8x8_cad_StartTransfer(u8x8);
+  u8x8_cad_SendCmd(u8x8, 0x02e);
+  u8x8_cad_EndTransfer(u8x8);
+}
+
+/*
+  Description:
+    Set the RAM row shown in the top line of the display (0..63). The
+    display wraps around, so stepping the line scrolls the whole screen
+    vertically without sending the RAM again.
+*/
+void u8x8_ssd1306_SetStartLine(u8x8_t *u8x8, uint8_t line)
+{
+  u8x8_cad_StartTransfer(u8x8);
+  u8x8_cad_SendCmd(u8x8, 0x040 | (line & 0x03f));
+  u8x8_cad_EndTransfer(u8x8);
+}
+
+/*
+  Description:
+    Show the display RAM inverted (is_inverted = 1) or normal (0).
+*/
+void u8x8_ssd1306_SetInvert(u8x8_t *u8x8, uint8_t is_inverted)
+{
+  u8x8_cad_StartTransfer(u8x8);
+  u8x8_cad_SendCmd(u8x8, is_inverted ? 0x0a7 : 0x0a6);
+  u8x8_cad_EndTransfer(u8x8);
+}
@@ -66,3 +66,23 @@ const char *u8x8_u16toa(uint16_t v, uint8_t d)
   return u8x8_u16toap(buf, v) + d;
 }
 
+/*
+  Right aligned conversion into "cnt" characters (1..5), leading zeros are
+  blanks. Digits which do not fit are dropped from the left. Like
+  u8x8_u16toap() it only subtracts, there is no division.
+  dest needs cnt+1 bytes. Returns a pointer to the first digit in dest,
+  which is the same number left aligned.
+*/
+const char *u8x8_u16toar(char *dest, uint16_t v, uint8_t cnt)
+{
+  char buf[6];
+  uint8_t i;
+  
+  u8x8_u16toap(buf, v);
+  for( i = 0; i < cnt; i++ )
+    dest[i] = buf[5-cnt+i];
+  dest[cnt] = '\0';
+  for( i = 0; i+1 < cnt && dest[i] == '0'; i++ )
+    dest[i] = ' ';
+  return dest+i;
+}
@@ -14,9 +14,12 @@
 void SPI_Init(void);
 void SPI_Tx(uint8_t data);
 void SPI_TxBuffer(uint8_t *buffer, uint8_t length);
-bool SPI_Write(uint32_t value);
-bool SPI_HasTransferCompleted();
-bool SPI_HasXmitBufferSpaceOpened();
-uint8_t SPI_GetNumOpenXmitSpaces();
+
+void SPI_QueueBegin(void);
+bool SPI_IsQueueing(void);
+void SPI_QueueSetDC(uint8_t dc);
+void SPI_QueueBytes(uint8_t *buffer, uint8_t length);
+void SPI_QueueStart(void (*Done)(void));
+bool SPI_IsQueueBusy(void);
 
 #endif	/* SPI_MATERH */
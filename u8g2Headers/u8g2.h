@@ -132,6 +132,118 @@
 */
 #define U8G2_WITH_UNICODE
 
+/*
+  The following macro enables dirty tile tracking for full buffer displays which use
+  u8g2_ll_hvline_vertical_top_lsb (SSD13xx). Every 8x8 tile touched by the low level
+  hvline procedure or erased by u8g2_ClearBuffer() is marked, and u8g2_SendDirtyTiles()
+  transfers only the marked tiles. Requires tile_width <= 32 and
+  tile_buf_height <= U8G2_DIRTY_TILE_ROWS. Costs 4 bytes RAM per tile row.
+  Define U8G2_WITHOUT_DIRTY_TILES to leave it out.
+*/
+#ifndef U8G2_WITHOUT_DIRTY_TILES
+#define U8G2_WITH_DIRTY_TILES
+#endif
+
+#ifndef U8G2_DIRTY_TILE_ROWS
+#define U8G2_DIRTY_TILE_ROWS 8
+#endif
+
+/*
+  The following macro lets a full buffer have a second buffer of the same size, given
+  by u8g2_SetBackBuffer(). Once the transfer of the buffer has been started,
+  u8g2_SwapBuffer() makes the other one the buffer for drawing, starting from a copy of
+  the content just sent. The next frame can then be drawn while the last one is still
+  read by the transfer, e.g. by DMA. Costs one pointer of RAM without a back buffer.
+  Define U8G2_WITHOUT_BACK_BUFFER to leave it out.
+*/
+#ifndef U8G2_WITHOUT_BACK_BUFFER
+#define U8G2_WITH_BACK_BUFFER
+#endif
+
+/*
+  The following macro lets the bitmap procedures (u8g2_DrawXBM(), u8g2_DrawBitmap(),
+  u8g2_DrawPageBitmap(), ...) write whole column bytes into a u8g2_ll_hvline_vertical_top_lsb
+  buffer (SSD13xx) with u8g2_PageBlit(), if the bitmap is completely visible and the
+  display is not rotated. Otherwise they draw pixel by pixel as before.
+  Define U8G2_WITHOUT_PAGE_BLIT to leave the fast path out.
+*/
+#ifndef U8G2_WITHOUT_PAGE_BLIT
+#define U8G2_WITH_PAGE_BLIT
+#endif
+
+/*
+  The following macro lets u8g2_DrawBox() fill a u8g2_ll_hvline_vertical_top_lsb buffer
+  (SSD13xx) page by page with u8g2_ll_box_vertical_top_lsb(): one mask for the top and
+  one for the bottom page of the box, whole bytes for the pages in between. Rotated
+  displays and boxes which wrap around the coordinate range still draw line by line.
+  Define U8G2_WITHOUT_BOX_FILL to leave the fast path out.
+*/
+#ifndef U8G2_WITHOUT_BOX_FILL
+#define U8G2_WITH_BOX_FILL
+#endif
+
+/*
+  The following macro lets u8g2_DrawDisc(), u8g2_DrawFilledEllipse(), u8g2_DrawPolygon()
+  and u8g2_DrawLine() fill a u8g2_ll_hvline_vertical_top_lsb buffer (SSD13xx) through
+  u8g2_FillSpans(): the shape is clipped once, collected as one span per row for each
+  page it covers and written with one byte mask per run of columns by
+  u8g2_ll_span_vertical_top_lsb(), instead of one clipped line per row or column.
+  Each pixel is written once, so XOR mode works for these shapes as well. Rotated
+  displays still draw line by line.
+  Define U8G2_WITHOUT_SPAN_FILL to leave the fast path out.
+*/
+#ifndef U8G2_WITHOUT_SPAN_FILL
+#define U8G2_WITH_SPAN_FILL
+#endif
+
+/*
+  The following macro enables a faster decoder for glyphs which are drawn without
+  rotation and completely inside the visible area of a u8g2_ll_hvline_vertical_top_lsb
+  buffer (SSD13xx). The compressed glyph is read through a 32 bit bit reservoir, and
+  the pixel runs are written straight into the column bytes of the buffer instead of
+  calling u8g2_DrawHVLine() for each run. All other glyphs use the generic decoder.
+  Define U8G2_WITHOUT_DIRECT_GLYPH_DECODE to leave it out.
+*/
+#ifndef U8G2_WITHOUT_DIRECT_GLYPH_DECODE
+#define U8G2_WITH_DIRECT_GLYPH_DECODE
+#endif
+
+/*
+  The following macro enables a glyph cache for the same displays. The first time a
+  glyph (encoding below 128) of the current font is drawn, it is decoded into page
+  aligned column bitmaps, and from then on it is copied into the buffer byte by byte
+  instead of being run length decoded again. Glyphs which are rotated, which are not
+  completely inside the visible area or which do not fit into the cache are drawn by
+  the decoder as before. u8g2_SetFont() empties the cache.
+  The cache is a u8g2_glyph_cache_t provided by the caller with u8g2_SetGlyphCache(),
+  without one all glyphs are decoded. U8G2_GLYPH_CACHE_SIZE is the budget for the
+  bitmaps in bytes (a glyph needs width * ((height+7)/8) bytes), U8G2_GLYPH_CACHE_GLYPHS
+  the number of glyphs.
+  RAM: U8G2_GLYPH_CACHE_SIZE + 8*U8G2_GLYPH_CACHE_GLYPHS + 132 bytes per cache, and a
+  pointer in u8g2_t. Nothing is compiled in unless U8G2_WITH_GLYPH_CACHE is defined.
+*/
+//#define U8G2_WITH_GLYPH_CACHE
+
+#ifndef U8G2_GLYPH_CACHE_SIZE
+#define U8G2_GLYPH_CACHE_SIZE 1536
+#endif
+#ifndef U8G2_GLYPH_CACHE_GLYPHS
+#define U8G2_GLYPH_CACHE_GLYPHS 56
+#endif
+
+/*
+  The following macro enables an optional glyph index. If a buffer is assigned with
+  u8g2_SetFontIndexBuffer(), u8g2_SetFont() fills it with the offset of every glyph
+  of the font, and the glyph lookup becomes a table access instead of a walk through
+  the glyph list. The buffer needs (last-first+1) words for the glyphs with encoding
+  0..255 (e.g. 96 words for a "_r" font) and 2 words per unicode glyph. If it is too
+  small for the unicode part, only the 8 bit glyphs are indexed; if it is too small
+  for those, the font is used without index.
+  RAM: the buffer, and a pointer plus 8 bytes in u8g2_t. Nothing is compiled in
+  unless U8G2_WITH_FONT_INDEX is defined.
+*/
+//#define U8G2_WITH_FONT_INDEX
+
 
 
 
@@ -248,6 +360,29 @@ struct _u8g2_font_decode_t
 };
 typedef struct _u8g2_font_decode_t u8g2_font_decode_t;
 
+#ifdef U8G2_WITH_GLYPH_CACHE
+struct _u8g2_glyph_cache_entry_t
+{
+  uint16_t offset;		/* first column of the glyph in bitmap[] */
+  uint8_t width;		/* number of columns */
+  uint8_t height;		/* (height+7)/8 bytes per column, bit 0 of the first byte is the top row */
+  int8_t x;			/* glyph offset and advance, as in the font */
+  int8_t y;
+  int8_t delta_x;
+};
+typedef struct _u8g2_glyph_cache_entry_t u8g2_glyph_cache_entry_t;
+
+struct _u8g2_glyph_cache_t
+{
+  uint8_t slot[128];		/* per encoding: 0 not looked at yet, 255 not cached, else entry index+1 */
+  uint8_t glyph_cnt;		/* entries in use */
+  uint16_t bitmap_used;		/* bytes of bitmap[] in use */
+  u8g2_glyph_cache_entry_t entry[U8G2_GLYPH_CACHE_GLYPHS];
+  uint8_t bitmap[U8G2_GLYPH_CACHE_SIZE];
+};
+typedef struct _u8g2_glyph_cache_t u8g2_glyph_cache_t;
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
 struct _u8g2_kerning_t
 {
   uint16_t first_table_cnt;
@@ -259,6 +394,38 @@ struct _u8g2_kerning_t
 };
 typedef struct _u8g2_kerning_t u8g2_kerning_t;
 
+/* digits 0..9 and a blank, prerendered for u8g2_DrawDigits() */
+struct _u8g2_digit_atlas_t
+{
+  uint8_t w;			/* width of a cell, the advance of a digit */
+  uint8_t h;			/* height of a cell in pixel */
+  uint8_t ascent;		/* rows of a cell above the baseline */
+  const uint8_t *bitmap;	/* (h+7)/8 pages of 11*w column bytes, cell n at n*w */
+};
+typedef struct _u8g2_digit_atlas_t u8g2_digit_atlas_t;
+
+/* recorded drawing commands, see u8g2_displaylist.c */
+struct _u8g2_dl_t
+{
+  uint8_t *buf;
+  uint16_t size;		/* of buf */
+  uint16_t len;			/* bytes used by the commands */
+  uint8_t is_overflow;		/* a command did not fit and was dropped */
+  uint32_t dirty_pages;		/* bit n: tile row n changed since the last transfer */
+};
+typedef struct _u8g2_dl_t u8g2_dl_t;
+
+/* the rows of a shape within one page, see u8g2_span.c */
+struct _u8g2_span_t
+{
+  int16_t x0[8];		/* first column of each row of the page */
+  int16_t x1[8];		/* column after the last one, x1 <= x0: empty row */
+  int16_t y;			/* top row of the page */
+  int16_t y0, y1;		/* rows y0 to y1-1 of the page are visible */
+};
+typedef struct _u8g2_span_t u8g2_span_t;
+typedef void (*u8g2_span_rows_cb)(u8g2_t *u8g2, u8g2_span_t *span, void *shape);
+
 
 struct u8g2_cb_struct
 {
@@ -341,6 +508,31 @@ struct u8g2_struct
 					
 	// the following variable should be renamed to is_buffer_auto_clear
   uint8_t is_auto_page_clear; 		/* set to 0 to disable automatic clear of the buffer in firstPage() and nextPage() */
+
+#ifdef U8G2_WITH_BACK_BUFFER
+  uint8_t *back_buf_ptr;		/* the buffer which is not drawn into, NULL: none */
+#endif /* U8G2_WITH_BACK_BUFFER */
+
+#ifdef U8G2_WITH_DIRTY_TILES
+  /* one bit per tile of the buffer, bit n of dirty_tiles[r] is tile column n of buffer tile row r */
+  uint32_t dirty_tiles[U8G2_DIRTY_TILE_ROWS];
+#endif /* U8G2_WITH_DIRTY_TILES */
+
+#ifdef U8G2_WITH_GLYPH_CACHE
+  u8g2_glyph_cache_t *glyph_cache;	/* caller provided, see u8g2_SetGlyphCache(), NULL: none */
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
+#ifdef U8G2_WITH_FONT_INDEX
+  /* caller provided index buffer, see u8g2_SetFontIndexBuffer() */
+  /* layout: offset of glyph font_index_first+i at [i] (0: no glyph), */
+  /* then font_index_unicode_cnt pairs of (encoding, offset), sorted by encoding */
+  uint16_t *font_index;
+  uint16_t font_index_len;		/* size of the buffer in words */
+  uint16_t font_index_cnt;		/* number of words for 8 bit glyphs */
+  uint16_t font_index_unicode_cnt;
+  uint8_t font_index_first;
+  uint8_t font_index_flags;		/* U8G2_FONT_INDEX_xxx: which part of the index is valid */
+#endif /* U8G2_WITH_FONT_INDEX */
   
 };
 
@@ -1077,8 +1269,20 @@ void u8g2_Setup_a2printer_384x240_f(u8g2_t *u8g2, const u8g2_cb_t *rotation, u8x
 void u8g2_SendBuffer(u8g2_t *u8g2);
 void u8g2_ClearBuffer(u8g2_t *u8g2);
 
+/* raster operations for u8g2_ComposeBuffer() */
+#define U8G2_ROP_COPY 0
+#define U8G2_ROP_OR 1
+#define U8G2_ROP_XOR 2
+#define U8G2_ROP_ANDNOT 3
+void u8g2_ComposeBuffer(u8g2_t *u8g2, const uint8_t *image, uint8_t rop);
+
 void u8g2_SetBufferCurrTileRow(u8g2_t *u8g2, uint8_t row) U8G2_NOINLINE;
 
+#ifdef U8G2_WITH_BACK_BUFFER
+void u8g2_SetBackBuffer(u8g2_t *u8g2, uint8_t *buf);
+void u8g2_SwapBuffer(u8g2_t *u8g2);
+#endif /* U8G2_WITH_BACK_BUFFER */
+
 void u8g2_FirstPage(u8g2_t *u8g2);
 uint8_t u8g2_NextPage(u8g2_t *u8g2);
 
@@ -1092,6 +1296,16 @@ uint8_t u8g2_NextPage(u8g2_t *u8g2);
 
 void u8g2_UpdateDisplayArea(u8g2_t *u8g2, uint8_t  tx, uint8_t ty, uint8_t tw, uint8_t th);
 void u8g2_UpdateDisplay(u8g2_t *u8g2);
+/* one address window and one stream of data, the display must support U8X8_MSG_DISPLAY_DRAW_WINDOW to benefit */
+void u8g2_SendWindow(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+void u8g2_SendFrame(u8g2_t *u8g2);
+
+#ifdef U8G2_WITH_DIRTY_TILES
+void u8g2_MarkBufferDirty(u8g2_t *u8g2);
+void u8g2_MarkDirtyBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_ClearDirtyTiles(u8g2_t *u8g2, uint8_t tx, uint8_t ty, uint8_t tw, uint8_t th);
+void u8g2_SendDirtyTiles(u8g2_t *u8g2);
+#endif /* U8G2_WITH_DIRTY_TILES */
 
 
 /*==========================================*/
@@ -1110,6 +1324,29 @@ void u8g2_ll_hvline_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y,
 /* ST7920 */
 void u8g2_ll_hvline_horizontal_right_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t len, uint8_t dir);
 
+#ifdef U8G2_WITH_BOX_FILL
+/*
+  x,y		Upper left corner of the box within the local buffer (not the display!)
+  w,h		size of the box in pixel, must not be 0
+  asumption: 
+    all clipping done
+*/
+/* SSD13xx, UC17xx, UC16xx */
+void u8g2_ll_box_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+#endif /* U8G2_WITH_BOX_FILL */
+
+#if defined(U8G2_WITH_BOX_FILL) || defined(U8G2_WITH_SPAN_FILL)
+/*
+  x,y		first column and a row of the page within the local buffer (not the display!)
+  w		number of columns, must not be 0
+  mask		rows of the page to draw, bit 0 is the top row
+  asumption: 
+    all clipping done
+*/
+/* SSD13xx, UC17xx, UC16xx */
+void u8g2_ll_span_vertical_top_lsb(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, uint8_t mask);
+#endif
+
 
 /*==========================================*/
 /* u8g2_hvline.c */
@@ -1131,6 +1368,44 @@ void u8g2_DrawHorizontalBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_
 void u8g2_DrawBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t cnt, u8g2_uint_t h, const uint8_t *bitmap);
 void u8g2_DrawXBM(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
 void u8g2_DrawXBMP(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);	/* assumes bitmap in PROGMEM */
+void u8g2_DrawPageBitmap(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+
+uint8_t u8g2_IsPageBlitBuffer(u8g2_t *u8g2);
+uint8_t u8g2_IsPageBlitBox(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+void u8g2_PageBlit(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *src, uint8_t col_step, uint16_t page_step, uint8_t color, uint8_t is_transparent);
+void u8g2_DrawDigits(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, const u8g2_digit_atlas_t *atlas, uint16_t v, uint8_t cnt);
+
+
+/*==========================================*/
+/* u8g2_displaylist.c */
+void u8g2_InitDisplayList(u8g2_dl_t *dl, uint8_t *buf, uint16_t size);
+void u8g2_ClearDisplayList(u8g2_dl_t *dl);
+#define u8g2_GetDisplayListMark(dl) ((dl)->len)
+void u8g2_RewindDisplayList(u8g2_dl_t *dl, uint16_t mark);
+void u8g2_MarkDisplayListRows(u8g2_dl_t *dl, u8g2_uint_t y, u8g2_uint_t h);
+uint8_t u8g2_RecordImage(u8g2_t *u8g2, u8g2_dl_t *dl, const uint8_t *image, uint8_t rop);
+uint8_t u8g2_RecordBox(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h);
+uint8_t u8g2_RecordPageBitmap(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+uint8_t u8g2_RecordXBM(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap);
+uint8_t u8g2_RecordStr(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, const char *s);
+uint8_t u8g2_RecordDigits(u8g2_t *u8g2, u8g2_dl_t *dl, u8g2_uint_t x, u8g2_uint_t y, const u8g2_digit_atlas_t *atlas, uint16_t v, uint8_t cnt);
+uint8_t u8g2_RecordRleFrame(u8g2_t *u8g2, u8g2_dl_t *dl, const uint8_t *rle);
+void u8g2_DrawDisplayList(u8g2_t *u8g2, const u8g2_dl_t *dl);
+uint32_t u8g2_SendDisplayList(u8g2_t *u8g2, u8g2_dl_t *dl);
+
+
+/*==========================================*/
+/* u8g2_rle.c */
+void u8g2_DrawRleFrame(u8g2_t *u8g2, const uint8_t *rle);
+
+
+/*==========================================*/
+/* u8g2_span.c */
+#ifdef U8G2_WITH_SPAN_FILL
+uint8_t u8g2_FillSpans(u8g2_t *u8g2, int16_t y0, int16_t y1, u8g2_span_rows_cb rows, void *shape);
+void u8g2_AddSpans(u8g2_span_t *span, int16_t x0, int16_t x1, int16_t y0, int16_t y1);
+void u8g2_AddSpan(u8g2_span_t *span, int16_t x0, int16_t x1, int16_t y);
+#endif /* U8G2_WITH_SPAN_FILL */
 
 
 /*==========================================*/
@@ -1194,6 +1469,16 @@ size_t u8g2_GetFontSize(const uint8_t *font_arg);
 void u8g2_SetFont(u8g2_t *u8g2, const uint8_t  *font);
 void u8g2_SetFontMode(u8g2_t *u8g2, uint8_t is_transparent);
 
+#ifdef U8G2_WITH_FONT_INDEX
+#define U8G2_FONT_INDEX_8BIT 1
+#define U8G2_FONT_INDEX_UNICODE 2
+void u8g2_SetFontIndexBuffer(u8g2_t *u8g2, uint16_t *buf, uint16_t len);
+#endif /* U8G2_WITH_FONT_INDEX */
+
+#ifdef U8G2_WITH_GLYPH_CACHE
+void u8g2_SetGlyphCache(u8g2_t *u8g2, u8g2_glyph_cache_t *cache);
+#endif /* U8G2_WITH_GLYPH_CACHE */
+
 uint8_t u8g2_IsGlyph(u8g2_t *u8g2, uint16_t requested_encoding);
 int8_t u8g2_GetGlyphWidth(u8g2_t *u8g2, uint16_t requested_encoding);
 u8g2_uint_t u8g2_DrawGlyph(u8g2_t *u8g2, u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding);
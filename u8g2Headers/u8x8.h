@@ -44,6 +44,7 @@
     U8X8_MSG_DISPLAY_SET_POWER_SAVE
     U8X8_MSG_DISPLAY_SET_CONTRAST
     U8X8_MSG_DISPLAY_DRAW_TILE
+    U8X8_MSG_DISPLAY_DRAW_WINDOW			optional
 
   A display driver may decided to breakdown these messages to a lower level interface or
   implement this functionality directly.
@@ -94,6 +95,18 @@
 /* Define this for an additional user pointer inside the u8x8 data struct */
 //#define U8X8_WITH_USER_PTR
 
+/*
+  The following macro is for a build with a single SSD1306 on SPI, whose byte procedure
+  also provides u8x8_byte_DirectSend(). u8x8_DrawTile() and u8x8_DrawWindow() then call
+  u8x8_d_ssd1306_DrawWindow() directly, which hands the window commands and the tile
+  data to u8x8_byte_DirectSend(): the display, cad and byte procedures are not called
+  for them, and DC is set once per transfer instead of once per byte.
+  Define U8X8_WITHOUT_FIXED_SSD1306_SPI to go through the procedures of the setup.
+*/
+#ifndef U8X8_WITHOUT_FIXED_SSD1306_SPI
+#define U8X8_WITH_FIXED_SSD1306_SPI
+#endif
+
 
 /* Undefine this to remove u8x8_SetFlipMode function */
 /* 26 May 2016: Obsolete */
@@ -195,6 +208,7 @@ uint8_t u8x8_pgm_read_esp(const uint8_t * addr);   /* u8x8_8x8.c */
 typedef struct u8x8_struct u8x8_t;
 typedef struct u8x8_display_info_struct u8x8_display_info_t;
 typedef struct u8x8_tile_struct u8x8_tile_t;
+typedef struct u8x8_window_struct u8x8_window_t;
 
 typedef uint8_t (*u8x8_msg_cb)(u8x8_t *u8x8, uint8_t msg, uint8_t arg_int, void *arg_ptr);
 typedef uint16_t (*u8x8_char_cb)(u8x8_t *u8x8, uint8_t b);
@@ -217,6 +231,16 @@ struct u8x8_tile_struct
   uint8_t y_pos;	/* tile x position */
 };
 
+struct u8x8_window_struct
+{
+  uint8_t *tile_ptr;	/* first tile of the top row */
+  uint16_t stride;	/* bytes from one tile row to the next in memory */
+  uint8_t x_pos;	/* first tile x position */
+  uint8_t y_pos;	/* first tile y position */
+  uint8_t w;		/* number of tiles per row */
+  uint8_t h;		/* number of tile rows */
+};
+
 
 struct u8x8_display_info_struct
 {
@@ -517,6 +541,28 @@ void u8x8_d_helper_display_init(u8x8_t *u8g2);
 */
 #define U8X8_MSG_DISPLAY_REFRESH 16
 
+/*
+  Name: 	U8X8_MSG_DISPLAY_DRAW_WINDOW
+  Args:	
+    arg_int: -
+    arg_ptr: pointer to u8x8_window_t
+        uint8_t *tile_ptr;	pointer to the first tile of the top row
+        uint16_t stride;	bytes from one row of tiles to the next
+	uint8_t x_pos;		first tile x position
+	uint8_t y_pos;		first tile y position 
+	uint8_t w;		tiles per row
+	uint8_t h;		rows of tiles
+  Tasks:
+    Draw a rectangle of w x h tiles with one address window: the
+    controller is told the window once and all w*h*8 bytes follow
+    as one stream of data. Rows with stride = 8*w are contiguous.
+    Optional: a display which can not do this returns 0 and the
+    caller falls back to U8X8_MSG_DISPLAY_DRAW_TILE.
+  Use
+    uint8_t u8x8_DrawWindow(...)
+*/
+#define U8X8_MSG_DISPLAY_DRAW_WINDOW 17
+
 /*==========================================*/
 /* u8x8_setup.c */
 
@@ -535,6 +581,15 @@ void u8x8_Setup(u8x8_t *u8x8, u8x8_msg_cb display_cb, u8x8_msg_cb cad_cb, u8x8_m
 /*==========================================*/
 /* u8x8_display.c */
 uint8_t u8x8_DrawTile(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t cnt, uint8_t *tile_ptr);
+/* returns 0 if the display has no address window, use u8x8_DrawTile() then */
+uint8_t u8x8_DrawWindow(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *tile_ptr, uint16_t stride);
+
+#ifdef U8X8_WITH_FIXED_SSD1306_SPI
+/* u8x8_d_ssd1306_128x64_noname.c */
+void u8x8_d_ssd1306_DrawWindow(u8x8_t *u8x8, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t *tile_ptr, uint16_t stride);
+/* provided with the byte procedure: send cnt bytes with DC at dc (0: commands, 1: data) */
+void u8x8_byte_DirectSend(u8x8_t *u8x8, uint8_t dc, uint8_t cnt, uint8_t *data);
+#endif
 
 /* 
   After a call to u8x8_SetupDefaults, 
@@ -561,6 +616,27 @@ void u8x8_FillDisplay(u8x8_t *u8x8);
 void u8x8_RefreshDisplay(u8x8_t *u8x8);	// make RAM content visible on the display (Dec 16: SSD1606 only)
 void u8x8_ClearLine(u8x8_t *u8x8, uint8_t line);
 
+/*==========================================*/
+/* u8x8_ssd1306_fx.c: effects done by the SSD1306 controller */
+
+#define U8X8_SSD1306_SCROLL_RIGHT 0
+#define U8X8_SSD1306_SCROLL_LEFT 1
+
+/* time between two scroll steps, in frames */
+#define U8X8_SSD1306_SCROLL_FRAMES_2 7
+#define U8X8_SSD1306_SCROLL_FRAMES_3 4
+#define U8X8_SSD1306_SCROLL_FRAMES_4 5
+#define U8X8_SSD1306_SCROLL_FRAMES_5 0
+#define U8X8_SSD1306_SCROLL_FRAMES_25 6
+#define U8X8_SSD1306_SCROLL_FRAMES_64 1
+#define U8X8_SSD1306_SCROLL_FRAMES_128 2
+#define U8X8_SSD1306_SCROLL_FRAMES_256 3
+
+void u8x8_ssd1306_StartScroll(u8x8_t *u8x8, uint8_t dir, uint8_t start_page, uint8_t end_page, uint8_t interval, uint8_t vertical_offset);
+void u8x8_ssd1306_StopScroll(u8x8_t *u8x8);
+void u8x8_ssd1306_SetStartLine(u8x8_t *u8x8, uint8_t line);
+void u8x8_ssd1306_SetInvert(u8x8_t *u8x8, uint8_t is_inverted);
+
 
 
 /*==========================================*/
@@ -942,6 +1018,8 @@ uint8_t u8x8_Draw2x2String(u8x8_t *u8x8, uint8_t x, uint8_t y, const char *s);
 uint8_t u8x8_Draw2x2UTF8(u8x8_t *u8x8, uint8_t x, uint8_t y, const char *s);
 uint8_t u8x8_Draw1x2String(u8x8_t *u8x8, uint8_t x, uint8_t y, const char *s);
 uint8_t u8x8_Draw1x2UTF8(u8x8_t *u8x8, uint8_t x, uint8_t y, const char *s);
+void u8x8_RenderGlyph(u8x8_t *u8x8, uint8_t *buf, uint16_t stride, uint8_t encoding);
+uint8_t u8x8_RenderString(u8x8_t *u8x8, uint8_t *buf, uint8_t cnt, const char *s);	/* into memory, see u8x8_DrawWindow() */
 uint8_t u8x8_GetUTF8Len(u8x8_t *u8x8, const char *s);
 #define u8x8_SetInverseFont(u8x8, b) (u8x8)->is_font_inverse_mode = (b)
 
@@ -949,6 +1027,7 @@ uint8_t u8x8_GetUTF8Len(u8x8_t *u8x8, const char *s);
 /* itoa procedures */
 const char *u8x8_u8toa(uint8_t v, uint8_t d);
 const char *u8x8_u16toa(uint16_t v, uint8_t d);
+const char *u8x8_u16toar(char *dest, uint16_t v, uint8_t cnt);	/* right aligned, blank padded */
 
 
 /*==========================================*/